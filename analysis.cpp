@@ -0,0 +1,295 @@
+/*******************************************************************************
+ * filename:    analysis.cpp
+ * description: Summarises directories of network result files in parallel
+ * author:      agent
+ * created:     2026-10-17
+ * copyright:   Jacobs University Bremen. All rights reserved.
+ *******************************************************************************
+ * Every file ending in '--suffix' below the given directories, except for the
+ * parameters themselves, is mapped with a 'ResultView'. Legacy files take
+ * their layer sizes from the 'parameters.dat' in the same directory. The files
+ * are divided evenly among '--threads' threads and one line of comma separated
+ * values is written per file:
+ *
+ *  file,iteration,seed,connectivity,flow_error,robustness,links,active,reached
+ *
+ * where 'robustness' is empty for flow networks, 'active' is the number of
+ * middle nodes with incoming and outgoing links and 'reached' the number of
+ * output nodes with incoming links. Files that cannot be read are reported on
+ * standard error and skipped.
+ ******************************************************************************/
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+
+// std
+#include <cstdlib>
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <map>
+#include <algorithm>
+
+// boost
+#include <boost/thread/thread.hpp>
+#include <boost/bind/bind.hpp>
+#include <boost/algorithm/string/predicate.hpp>
+
+// project
+#include "rfn_config.hpp"
+#include "common_definitions.hpp"
+#include "C_ResultView.hpp"
+
+
+/*******************************************************************************
+ * Declarations
+ ******************************************************************************/
+
+
+// options of the analysis
+struct Settings {
+    std::vector<std::string> directories;
+    std::string suffix;
+    unsigned threads;
+    std::string output;
+};
+
+// a result file and what is learnt from it
+struct Summary {
+    std::string file;
+    rfn::ResultView::Layers layers;
+    bool valid;
+    unsigned long iteration;
+    unsigned seed;
+    double connectivity;
+    double flow_error;
+    double robustness;
+    unsigned links;
+    unsigned active;
+    unsigned reached;
+};
+
+
+/*******************************************************************************
+ * Function Declarations
+ ******************************************************************************/
+
+
+Settings parse_arguments(int argc, char** argv);
+void collect(const Settings& settings, std::vector<Summary>& summaries);
+void analyse(std::vector<Summary>& summaries, const unsigned first,
+    const unsigned stride);
+void summarise(const rfn::ResultView& view, Summary& summary);
+
+
+/*******************************************************************************
+ * Function Definitions
+ ******************************************************************************/
+
+
+int main(int argc, char** argv) {
+    using std::cerr;
+    using std::endl;
+    const Settings settings = parse_arguments(argc, argv);
+    std::ofstream file;
+    if (settings.output != "-") {
+        file.open(settings.output.c_str());
+        if (!file) {
+            cerr << "Cannot open '" << settings.output << "'. Aborting."
+                << endl;
+            std::exit(EXIT_FAILURE);
+        }
+    }
+    std::ostream& out = (settings.output != "-") ? file : std::cout;
+    std::vector<Summary> summaries;
+    collect(settings, summaries);
+    const unsigned num_threads = std::max(1u, std::min(settings.threads,
+        (unsigned)summaries.size()));
+    boost::thread_group workers;
+    for (unsigned t = 0; t < num_threads; ++t) {
+        workers.create_thread(boost::bind(&analyse, boost::ref(summaries), t,
+            num_threads));
+    }
+    workers.join_all();
+    out << "file,iteration,seed,connectivity,flow_error,robustness,links,"
+        "active,reached" << endl;
+    out.precision(12);
+    unsigned failed = 0u;
+    for (std::vector<Summary>::const_iterator it = summaries.begin();
+        it != summaries.end(); ++it)
+    {
+        if (!it->valid) {
+            cerr << "Cannot read '" << it->file << "', skipped." << endl;
+            ++failed;
+            continue;
+        }
+        out << it->file << "," << it->iteration << "," << it->seed << ","
+            << it->connectivity << "," << it->flow_error << ",";
+        if (it->robustness >= 0.0) {
+            out << it->robustness;
+        }
+        out << "," << it->links << "," << it->active << "," << it->reached
+            << "\n";
+    }
+    out.flush();
+    return (failed == 0u) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+Settings
+parse_arguments(int argc, char** argv)
+{
+    using std::cout;
+    using std::cerr;
+    using std::endl;
+    bpo::options_description options("Options");
+    options.add_options()
+        ("help,h", "print help message")
+        ("version,v", "print version information")
+        ("suffix", bpo::value<std::string>()->default_value("_final.dat"),
+            "analyse files whose name ends in this string")
+        ("threads", bpo::value<unsigned>()->default_value(
+            std::max(1u, boost::thread::hardware_concurrency())),
+            "number of threads reading files (integer)")
+        ("output,o", bpo::value<std::string>()->default_value("-"),
+            "file the results are written to, '-' for standard output")
+        ("directory", bpo::value<std::vector<std::string> >(),
+            "directories searched recursively for result files")
+    ;
+    bpo::positional_options_description positional;
+    positional.add("directory", -1);
+    bpo::variables_map vm;
+    try {
+        bpo::store(bpo::command_line_parser(argc, argv).options(options).
+            positional(positional).run(), vm);
+        bpo::notify(vm);
+    }
+    catch (std::exception& e) {
+        cerr << e.what() << endl;
+        std::exit(EXIT_FAILURE);
+    }
+    if (vm.count("help")) {
+        cout << "Usage:" << endl;
+        cout << argv[0] << " [options] directory [directory ...]" << endl;
+        cout << options << endl;
+        std::exit(EXIT_SUCCESS);
+    }
+    if (vm.count("version")) {
+        cout << RFN5_VERSION_MAJOR << "." << RFN5_VERSION_MINOR << "."
+            << RFN5_VERSION_PATCH << endl;
+        std::exit(EXIT_SUCCESS);
+    }
+    Settings settings;
+    if (vm.count("directory")) {
+        settings.directories = vm["directory"].as<std::vector<std::string> >();
+    }
+    else {
+        settings.directories.push_back(".");
+    }
+    settings.suffix = vm["suffix"].as<std::string>();
+    settings.threads = std::max(1u, vm["threads"].as<unsigned>());
+    settings.output = vm["output"].as<std::string>();
+    return settings;
+}
+
+/*
+ * Files are sorted by name for a reproducible order of the output, the layer
+ * sizes are read once per directory.
+ */
+void
+collect(const Settings& settings, std::vector<Summary>& summaries)
+{
+    std::vector<bfsys::path> files;
+    for (unsigned d = 0; d < settings.directories.size(); ++d) {
+        const bfsys::path dir(settings.directories[d]);
+        if (!bfsys::is_directory(dir)) {
+            std::cerr << "'" << dir.string() << "' is not a directory,"
+                " skipped." << std::endl;
+            continue;
+        }
+        for (bfsys::recursive_directory_iterator it(dir), end; it != end;
+            ++it)
+        {
+            if (bfsys::is_regular_file(it->status()) && boost::ends_with(
+                it->path().filename().string(), settings.suffix)
+                && it->path().filename() != "parameters.dat")
+            {
+                files.push_back(it->path());
+            }
+        }
+    }
+    std::sort(files.begin(), files.end());
+    std::map<bfsys::path, rfn::ResultView::Layers> layers;
+    std::map<bfsys::path, rfn::ResultView::Layers>::iterator it;
+    const rfn::ResultView::Layers unknown = {0u, 0u, 0u};
+    summaries.resize(files.size());
+    for (unsigned k = 0; k < files.size(); ++k) {
+        const bfsys::path dir = files[k].parent_path();
+        it = layers.find(dir);
+        if (it == layers.end()) {
+            it = layers.insert(std::make_pair(dir, unknown)).first;
+            if (!rfn::ResultView::layers((dir / "parameters.dat").string(),
+                it->second))
+            {
+                it->second = unknown;
+            }
+        }
+        summaries[k].file = files[k].string();
+        summaries[k].layers = it->second;
+        summaries[k].valid = true;
+    }
+}
+
+void
+analyse(std::vector<Summary>& summaries, const unsigned first,
+    const unsigned stride)
+{
+    rfn::ResultView view;
+    for (unsigned k = first; k < summaries.size(); k += stride) {
+        summaries[k].valid = view.open(summaries[k].file, summaries[k].layers);
+        if (summaries[k].valid) {
+            summarise(view, summaries[k]);
+        }
+    }
+}
+
+void
+summarise(const rfn::ResultView& view, Summary& summary)
+{
+    const unsigned end_in = view.layers().nodes_in;
+    const unsigned end_middle = end_in + view.layers().nodes_middle;
+    const unsigned num_nodes = end_middle + view.layers().nodes_out;
+    std::vector<unsigned> in_degree(num_nodes, 0u);
+    std::vector<unsigned> out_degree(num_nodes, 0u);
+    const rfn::Span<rfn::ResultView::Edge>& edges = view.edges();
+    for (const rfn::ResultView::Edge* e = edges.begin(); e != edges.end();
+        ++e)
+    {
+        if (e->source < num_nodes && e->target < num_nodes) {
+            ++out_degree[e->source];
+            ++in_degree[e->target];
+        }
+    }
+    summary.iteration = view.iteration();
+    summary.seed = view.seed();
+    summary.connectivity = view.connectivity();
+    summary.flow_error = view.flow_error();
+    summary.robustness = view.robustness();
+    summary.links = (unsigned)edges.size();
+    summary.active = 0u;
+    unsigned n = 0u;
+    for (n = end_in; n < end_middle; ++n) {
+        if (in_degree[n] > 0u && out_degree[n] > 0u) {
+            ++summary.active;
+        }
+    }
+    summary.reached = 0u;
+    for (n = end_middle; n < num_nodes; ++n) {
+        if (in_degree[n] > 0u) {
+            ++summary.reached;
+        }
+    }
+}
@@ -0,0 +1,562 @@
+/*******************************************************************************
+ * filename:    benchmarks.cpp
+ * description: Micro-benchmarks of the hot paths of an evolution
+ * author:      agent
+ * created:     2026-10-17
+ * copyright:   Jacobs University Bremen. All rights reserved.
+ *******************************************************************************
+ * Times the building blocks of an evolutionary step over a sweep of network
+ * sizes and connectivities. All networks of one configuration are drawn from
+ * the same seed, hence two builds are compared on identical networks.
+ *
+ * A benchmark is called in batches that are doubled in size until a batch
+ * takes at least '--min-time' seconds. The fastest and the median time per
+ * call of '--trials' batches of that size are reported as comma separated
+ * values, one line per benchmark and configuration.
+ ******************************************************************************/
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+
+// std
+#include <cstdlib>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <time.h>
+
+// gsl
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_matrix.h>
+
+// project
+#include "rfn_config.hpp"
+#include "common_definitions.hpp"
+#include "C_ParameterManager.hpp"
+#include "C_NoiseRobustParameterManager.hpp"
+#include "C_NetworkInitialiser.hpp"
+#include "C_PatternInitialiser.hpp"
+#include "C_Mutation.hpp"
+#include "C_FlowDistributionNetwork.hpp"
+#include "C_LinkRobustNetwork.hpp"
+#include "C_NodeRobustNetwork.hpp"
+#include "C_NoiseRobustNetwork.hpp"
+
+
+/*******************************************************************************
+ * Declarations
+ ******************************************************************************/
+
+
+// expose the internal functions under test, copies keep the type of the
+// original
+class FlowProbe: public rfn::FlowDistributionNetwork {
+public:
+    virtual rfn::FlowDistributionNetwork* clone()
+    {
+        return new FlowProbe(*this);
+    }
+    using rfn::FlowDistributionNetwork::generate_sle;
+    using rfn::FlowDistributionNetwork::generate_output;
+    using rfn::FlowDistributionNetwork::compute_output;
+    using rfn::FlowDistributionNetwork::compute_flow_error;
+};
+
+class LinkProbe: public rfn::LinkRobustNetwork {
+public:
+    virtual rfn::FlowDistributionNetwork* clone()
+    {
+        return new LinkProbe(*this);
+    }
+    using rfn::LinkRobustNetwork::compute_robustness;
+};
+
+class NodeProbe: public rfn::NodeRobustNetwork {
+public:
+    virtual rfn::FlowDistributionNetwork* clone()
+    {
+        return new NodeProbe(*this);
+    }
+    using rfn::NodeRobustNetwork::compute_robustness;
+};
+
+class NoiseProbe: public rfn::NoiseRobustNetwork {
+public:
+    virtual rfn::FlowDistributionNetwork* clone()
+    {
+        return new NoiseProbe(*this);
+    }
+    using rfn::NoiseRobustNetwork::compute_robustness;
+    using rfn::NoiseRobustNetwork::generate_output;
+    // one noise realisation of the SLE drawn from 'stream'
+    void generate_noise_sle(rfn::Matrix* const sle, rfn::Matrix* const weights,
+        rfn::RandGen& stream)
+    {
+        Real dist;
+        RealNumber values(stream, dist);
+        rfn::NoiseRobustNetwork::generate_noise_sle(sle, weights, values);
+    }
+};
+
+// options shared by all configurations
+struct Settings {
+    std::vector<std::string> sizes;
+    std::vector<double> connectivities;
+    unsigned seed;
+    double noise;
+    unsigned trials;
+    double min_time;
+    std::string filter;
+    rfn::SolverScheme solver;
+    rfn::BackendScheme backend;
+    std::string output;
+};
+
+// one configuration and the objects its benchmarks work on
+struct Context {
+    short unsigned nodes_in;
+    short unsigned nodes_middle;
+    short unsigned nodes_out;
+    double connectivity;
+    rfn::ParameterManager* parameters;
+    FlowProbe* flow;
+    rfn::FlowDistributionNetwork* copy;
+    NoiseProbe* noise;
+    rfn::FlowDistributionNetwork* robust;
+    rfn::Matrix* sle;
+    rfn::Matrix* system;
+    rfn::Matrix* weights;
+    rfn::RandGen stream;
+    rfn::Adjacency* graph;
+    rfn::Mutation* mutation;
+};
+
+// calls a benchmark 'reps' times
+typedef void (*Kernel)(Context& context, const unsigned long reps);
+
+
+/*******************************************************************************
+ * Function Declarations
+ ******************************************************************************/
+
+
+Settings parse_arguments(int argc, char** argv);
+void run_configuration(const Settings& settings, Context& context,
+    std::ostream& out);
+void measure(const std::string& name, Kernel kernel, const Settings& settings,
+    Context& context, std::ostream& out);
+double seconds();
+void bench_generate_sle(Context& context, const unsigned long reps);
+void bench_generate_output(Context& context, const unsigned long reps);
+void bench_generate_noise_sle(Context& context, const unsigned long reps);
+void bench_noise_output(Context& context, const unsigned long reps);
+void bench_compute_output(Context& context, const unsigned long reps);
+void bench_compute_flow_error(Context& context, const unsigned long reps);
+void bench_mutate(Context& context, const unsigned long reps);
+void bench_clone(Context& context, const unsigned long reps);
+void bench_assign(Context& context, const unsigned long reps);
+void bench_copy(Context& context, const unsigned long reps);
+template <class Probe>
+void bench_robustness(Context& context, const unsigned long reps);
+
+
+/*******************************************************************************
+ * Function Definitions
+ ******************************************************************************/
+
+
+int main(int argc, char** argv) {
+    using std::cerr;
+    using std::endl;
+    gsl_set_error_handler_off();
+    const Settings settings = parse_arguments(argc, argv);
+    std::ofstream file;
+    if (settings.output != "-") {
+        file.open(settings.output.c_str());
+        if (!file) {
+            cerr << "Cannot open '" << settings.output << "'. Aborting."
+                << endl;
+            std::exit(EXIT_FAILURE);
+        }
+    }
+    std::ostream& out = (settings.output != "-") ? file : std::cout;
+    out << "benchmark,nodes_in,nodes_middle,nodes_out,connectivity,seed,"
+        "backend,solver,calls,min_us,median_us" << std::endl;
+    Context context;
+    char separator = '\0';
+    for (unsigned s = 0; s < settings.sizes.size(); ++s) {
+        std::istringstream size(settings.sizes[s]);
+        size >> context.nodes_in >> separator >> context.nodes_middle
+            >> separator >> context.nodes_out;
+        if (!size || context.nodes_in == 0 || context.nodes_middle == 0
+            || context.nodes_out == 0)
+        {
+            cerr << "Invalid network size '" << settings.sizes[s]
+                << "', expected 'in:middle:out'. Aborting." << endl;
+            std::exit(EXIT_FAILURE);
+        }
+        for (unsigned c = 0; c < settings.connectivities.size(); ++c) {
+            context.connectivity = settings.connectivities[c];
+            run_configuration(settings, context, out);
+        }
+    }
+    return (EXIT_SUCCESS);
+}
+
+Settings
+parse_arguments(int argc, char** argv)
+{
+    using std::cout;
+    using std::cerr;
+    using std::endl;
+    std::vector<std::string> default_sizes;
+    default_sizes.push_back("8:20:8");
+    default_sizes.push_back("8:40:8");
+    default_sizes.push_back("16:80:16");
+    std::vector<double> default_connectivities;
+    default_connectivities.push_back(0.1);
+    default_connectivities.push_back(0.3);
+    bpo::options_description options("Options");
+    options.add_options()
+        ("help,h", "print help message")
+        ("version,v", "print version information")
+        ("sizes", bpo::value<std::vector<std::string> >()->multitoken()->
+            default_value(default_sizes, "8:20:8 8:40:8 16:80:16"),
+            "network sizes to sweep ('in:middle:out' ...)")
+        ("connectivities", bpo::value<std::vector<double> >()->multitoken()->
+            default_value(default_connectivities, "0.1 0.3"),
+            "connectivities to sweep (decimals between 0 and 1)")
+        ("seed,g", bpo::value<unsigned>()->default_value(1),
+            "seed of all networks (integer)")
+        ("noise", bpo::value<double>()->default_value(0.05),
+            "noise intensity of the noise robust networks (decimal)")
+        ("trials", bpo::value<unsigned>()->default_value(5),
+            "number of timed batches per benchmark (integer)")
+        ("min-time", bpo::value<double>()->default_value(0.05),
+            "minimum duration of a batch in seconds (decimal)")
+        ("filter", bpo::value<std::string>()->default_value(""),
+            "run only benchmarks whose name contains this string")
+        ("solver", bpo::value<std::string>()->default_value("dense"),
+            "how to solve the flow equations ('dense' | 'sparse')")
+        ("backend", bpo::value<std::string>()->default_value("gsl"),
+            "linear algebra backend ('gsl' | 'dense')")
+        ("output,o", bpo::value<std::string>()->default_value("-"),
+            "file the results are written to, '-' for standard output")
+    ;
+    bpo::variables_map vm;
+    try {
+        bpo::store(bpo::parse_command_line(argc, argv, options), vm);
+        bpo::notify(vm);
+    }
+    catch (std::exception& e) {
+        cerr << e.what() << endl;
+        std::exit(EXIT_FAILURE);
+    }
+    if (vm.count("help")) {
+        cout << "Usage:" << endl;
+        cout << argv[0] << " [options]" << endl;
+        cout << options << endl;
+        std::exit(EXIT_SUCCESS);
+    }
+    if (vm.count("version")) {
+        cout << RFN5_VERSION_MAJOR << "." << RFN5_VERSION_MINOR << "."
+            << RFN5_VERSION_PATCH << endl;
+        std::exit(EXIT_SUCCESS);
+    }
+    Settings settings;
+    settings.sizes = vm["sizes"].as<std::vector<std::string> >();
+    settings.connectivities = vm["connectivities"].as<std::vector<double> >();
+    settings.seed = vm["seed"].as<unsigned>();
+    settings.noise = vm["noise"].as<double>();
+    settings.trials = std::max(vm["trials"].as<unsigned>(), 1u);
+    settings.min_time = vm["min-time"].as<double>();
+    settings.filter = vm["filter"].as<std::string>();
+    settings.output = vm["output"].as<std::string>();
+    if (vm["solver"].as<std::string>() == "dense") {
+        settings.solver = rfn::dense_lu;
+    }
+    else if (vm["solver"].as<std::string>() == "sparse") {
+        settings.solver = rfn::sparse_lu;
+    }
+    else {
+        cerr << "No known linear solver specified. Aborting." << endl;
+        std::exit(EXIT_FAILURE);
+    }
+    if (vm["backend"].as<std::string>() == "dense") {
+        settings.backend = rfn::dense_backend;
+    }
+    else if (vm["backend"].as<std::string>() == "gsl") {
+        settings.backend = rfn::gsl_backend;
+    }
+    else {
+        cerr << "No known linear algebra backend specified. Aborting." << endl;
+        std::exit(EXIT_FAILURE);
+    }
+    return settings;
+}
+
+/*
+ * Every network of the configuration is drawn right after seeding the
+ * parameters, thus all of them share their links and ideal pattern.
+ */
+void
+run_configuration(const Settings& settings, Context& context,
+    std::ostream& out)
+{
+    rfn::NoiseRobustParameterManager* parameters =
+        static_cast<rfn::NoiseRobustParameterManager*>(
+        rfn::ParameterManager::instance(rfn::noise_robust));
+    CHECK_CRITICAL_POINTER(parameters);
+    parameters->nodes_in(context.nodes_in);
+    parameters->nodes_middle(context.nodes_middle);
+    parameters->nodes_out(context.nodes_out);
+    parameters->activated_k(std::max(context.nodes_out / 2, 1));
+    parameters->connectivity(context.connectivity);
+    parameters->add_mutation(0.5);
+    parameters->solver_type(settings.solver);
+    parameters->backend(settings.backend);
+    parameters->robust_threshold(0.007);
+    parameters->noise_level(settings.noise);
+    context.parameters = parameters;
+    const unsigned n = parameters->nodes_total();
+    context.sle = gsl_matrix_calloc(n, n);
+    CHECK_CRITICAL_GSL_POINTER(context.sle, __FILE__, __LINE__);
+    context.system = gsl_matrix_calloc(n, n);
+    CHECK_CRITICAL_GSL_POINTER(context.system, __FILE__, __LINE__);
+    context.weights = gsl_matrix_calloc(n, n);
+    CHECK_CRITICAL_GSL_POINTER(context.weights, __FILE__, __LINE__);
+    context.stream.seed(settings.seed);
+    parameters->seed(settings.seed);
+    context.flow = new FlowProbe();
+    CHECK_CRITICAL_POINTER(context.flow);
+    context.copy = context.flow->clone();
+    CHECK_CRITICAL_POINTER(context.copy);
+    context.flow->generate_sle(context.sle);
+    context.flow->compute_output();
+    measure("generate_sle", &bench_generate_sle, settings, context, out);
+    measure("generate_output", &bench_generate_output, settings, context,
+        out);
+    measure("compute_output", &bench_compute_output, settings, context, out);
+    measure("compute_flow_error", &bench_compute_flow_error, settings,
+        context, out);
+    measure("clone", &bench_clone, settings, context, out);
+    measure("assign", &bench_assign, settings, context, out);
+    measure("copy", &bench_copy, settings, context, out);
+    context.graph = new rfn::Adjacency(*context.flow->network());
+    CHECK_CRITICAL_POINTER(context.graph);
+    delete context.copy;
+    context.copy = NULL;
+    delete context.flow;
+    context.flow = NULL;
+    // robustness
+    parameters->seed(settings.seed);
+    context.robust = new LinkProbe();
+    CHECK_CRITICAL_POINTER(context.robust);
+    measure("link_robustness", &bench_robustness<LinkProbe>, settings, context,
+        out);
+    delete context.robust;
+    parameters->seed(settings.seed);
+    context.robust = new NodeProbe();
+    CHECK_CRITICAL_POINTER(context.robust);
+    measure("node_robustness", &bench_robustness<NodeProbe>, settings, context,
+        out);
+    delete context.robust;
+    parameters->seed(settings.seed);
+    context.noise = new NoiseProbe();
+    CHECK_CRITICAL_POINTER(context.noise);
+    context.robust = context.noise;
+    measure("generate_noise_sle", &bench_generate_noise_sle, settings, context,
+        out);
+    measure("noise_output", &bench_noise_output, settings, context, out);
+    measure("noise_robustness", &bench_robustness<NoiseProbe>, settings,
+        context, out);
+    delete context.robust;
+    context.robust = NULL;
+    context.noise = NULL;
+    // mutations of a copy of the links, the mutations of the networks above
+    // are chosen by the parameters
+    rfn::Mutation::release();
+    context.mutation = rfn::Mutation::instance(rfn::link_mutation);
+    measure("link_mutation", &bench_mutate, settings, context, out);
+    rfn::Mutation::release();
+    context.mutation = rfn::Mutation::instance(rfn::path_mutation);
+    measure("path_mutation", &bench_mutate, settings, context, out);
+    context.mutation = NULL;
+    delete context.graph;
+    context.graph = NULL;
+    gsl_matrix_free(context.sle);
+    context.sle = NULL;
+    gsl_matrix_free(context.system);
+    context.system = NULL;
+    gsl_matrix_free(context.weights);
+    context.weights = NULL;
+    // singletons are created anew for the next configuration
+    rfn::Mutation::release();
+    rfn::PatternInitialiser::release();
+    rfn::NetworkInitialiser::release();
+    rfn::ParameterManager::release();
+    context.parameters = NULL;
+}
+
+void
+measure(const std::string& name, Kernel kernel, const Settings& settings,
+    Context& context, std::ostream& out)
+{
+    if (name.find(settings.filter) == std::string::npos) {
+        return;
+    }
+    // calibrate the batch size, the last batch counts as the first trial
+    unsigned long reps = 1ul;
+    double start = seconds();
+    kernel(context, reps);
+    double elapsed = seconds() - start;
+    while (elapsed < settings.min_time && reps < (1ul << 30)) {
+        reps *= 2ul;
+        start = seconds();
+        kernel(context, reps);
+        elapsed = seconds() - start;
+    }
+    std::vector<double> per_call;
+    per_call.push_back(elapsed / (double)reps);
+    for (unsigned t = 1; t < settings.trials; ++t) {
+        start = seconds();
+        kernel(context, reps);
+        per_call.push_back((seconds() - start) / (double)reps);
+    }
+    std::sort(per_call.begin(), per_call.end());
+    out << name << "," << context.nodes_in << "," << context.nodes_middle
+        << "," << context.nodes_out << "," << context.connectivity << ","
+        << settings.seed << ","
+        << ((settings.backend == rfn::gsl_backend) ? "gsl" : "dense") << ","
+        << ((settings.solver == rfn::sparse_lu) ? "sparse" : "dense") << ","
+        << reps << "," << per_call.front() * 1e6 << ","
+        << per_call[per_call.size() / 2] * 1e6 << std::endl;
+}
+
+double
+seconds()
+{
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + 1e-9 * (double)now.tv_nsec;
+}
+
+void
+bench_generate_sle(Context& context, const unsigned long reps)
+{
+    for (unsigned long r = 0; r < reps; ++r) {
+        context.flow->generate_sle(context.sle);
+    }
+}
+
+/*
+ * The factorisation overwrites its input, hence every call includes copying
+ * the SLE.
+ */
+void
+bench_generate_output(Context& context, const unsigned long reps)
+{
+    for (unsigned long r = 0; r < reps; ++r) {
+        gsl_matrix_memcpy(context.system, context.sle);
+        context.flow->generate_output(context.system);
+    }
+}
+
+void
+bench_generate_noise_sle(Context& context, const unsigned long reps)
+{
+    for (unsigned long r = 0; r < reps; ++r) {
+        context.noise->generate_noise_sle(context.system, context.weights,
+            context.stream);
+    }
+}
+
+/*
+ * Evaluation of a single noise realisation, as done for every realisation of a
+ * robustness computation.
+ */
+void
+bench_noise_output(Context& context, const unsigned long reps)
+{
+    for (unsigned long r = 0; r < reps; ++r) {
+        context.noise->generate_noise_sle(context.system, context.weights,
+            context.stream);
+        context.noise->generate_output(context.system);
+    }
+}
+
+void
+bench_compute_output(Context& context, const unsigned long reps)
+{
+    for (unsigned long r = 0; r < reps; ++r) {
+        context.flow->compute_output();
+    }
+}
+
+void
+bench_compute_flow_error(Context& context, const unsigned long reps)
+{
+    for (unsigned long r = 0; r < reps; ++r) {
+        context.flow->compute_flow_error();
+    }
+}
+
+/*
+ * Every mutation is undone so that all of them start from the same links.
+ */
+void
+bench_mutate(Context& context, const unsigned long reps)
+{
+    unsigned k = 0u;
+    for (unsigned long r = 0; r < reps; ++r) {
+        context.mutation->mutate(context.graph);
+        const std::vector<rfn::Mutation::Link>& changes =
+            context.mutation->changes();
+        for (k = (unsigned)changes.size(); k-- > 0;) {
+            context.graph->flip_edge(changes[k].first, changes[k].second);
+        }
+    }
+}
+
+void
+bench_clone(Context& context, const unsigned long reps)
+{
+    rfn::FlowDistributionNetwork* copy = NULL;
+    for (unsigned long r = 0; r < reps; ++r) {
+        copy = context.flow->clone();
+        delete copy;
+    }
+}
+
+void
+bench_assign(Context& context, const unsigned long reps)
+{
+    for (unsigned long r = 0; r < reps; ++r) {
+        *context.copy = *context.flow;
+    }
+}
+
+void
+bench_copy(Context& context, const unsigned long reps)
+{
+    for (unsigned long r = 0; r < reps; ++r) {
+        context.copy->copy(*context.flow);
+    }
+}
+
+template <class Probe>
+void
+bench_robustness(Context& context, const unsigned long reps)
+{
+    Probe* const probe = static_cast<Probe*>(context.robust);
+    for (unsigned long r = 0; r < reps; ++r) {
+        probe->compute_robustness();
+    }
+}
+
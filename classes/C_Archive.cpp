@@ -0,0 +1,555 @@
+/*******************************************************************************
+ * filename:    C_Archive.cpp
+ * description: Implementation of 'Archive' class
+ * author:      agent
+ * created:     2026-10-17
+ * copyright:   Jacobs University Bremen. All rights reserved.
+ ******************************************************************************/
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+
+// std
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <algorithm>
+#include <fcntl.h>
+#include <unistd.h>
+
+// project
+#include "C_Archive.hpp"
+#include "C_BinaryStream.hpp"
+
+
+/*******************************************************************************
+ * Static Data Members
+ ******************************************************************************/
+
+
+const char rfn::Archive::FILE_MAGIC[8] = {'R', 'F', 'N', 'A', 'R', 'C', 'H',
+    'V'};
+const char rfn::Archive::RECORD_MAGIC[4] = {'R', 'F', 'N', 'R'};
+const char rfn::Archive::INDEX_MAGIC[8] = {'R', 'F', 'N', 'I', 'N', 'D', 'E',
+    'X'};
+
+
+/*******************************************************************************
+ * Constructors & Destructor
+ ******************************************************************************/
+
+
+rfn::Archive::Archive(const std::string& path, const bool writable):
+    _path(path),
+    _file(),
+    _writable(writable),
+    _version(VERSION),
+    _modified(false),
+    _end(0u),
+    _runs(),
+    _ids(),
+    _index(),
+    _lock()
+{
+    if (writable && (!bfsys::exists(path) || bfsys::file_size(path) == 0)) {
+        std::string header(FILE_MAGIC, sizeof(FILE_MAGIC));
+        BinaryFormat::encode_u32(header, VERSION);
+        BinaryFormat::encode_u32(header, HEADER_SIZE);
+        header.resize(HEADER_SIZE, '\0');
+        bfsys::ofstream create(path, std::ios::binary | std::ios::trunc);
+        create.write(header.data(), header.size());
+        create.close();
+    }
+    std::ios::openmode mode = std::ios::in | std::ios::binary;
+    if (writable) {
+        mode |= std::ios::out;
+    }
+    this->_file.open(path, mode);
+    if (!this->_file) {
+        std::cerr << "Cannot open archive '" << path << "'. Aborting."
+            << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+    this->load();
+    if (!writable) {
+        std::stable_sort(this->_index.begin(), this->_index.end(),
+            &rfn::Archive::precedes);
+    }
+}
+
+/*
+ * Destructor
+ */
+rfn::Archive::~Archive()
+{
+    if (this->_writable && this->_modified) {
+        boost::mutex::scoped_lock guard(this->_lock);
+        std::string footer;
+        footer.reserve(this->_index.size() * ENTRY_SIZE + TRAILER_SIZE);
+        for (size_t k = 0; k < this->_index.size(); ++k) {
+            BinaryFormat::encode_u32(footer, this->_index[k].run);
+            BinaryFormat::encode_u32(footer, this->_index[k].kind);
+            BinaryFormat::encode_u64(footer, this->_index[k].time);
+            BinaryFormat::encode_u64(footer, this->_index[k].offset);
+            BinaryFormat::encode_u64(footer, this->_index[k].size);
+        }
+        const boost::uint32_t sum = BinaryFormat::checksum(footer.data(),
+            footer.size());
+        BinaryFormat::encode_u64(footer, this->_end);
+        BinaryFormat::encode_u64(footer, this->_index.size());
+        BinaryFormat::encode_u32(footer, sum);
+        BinaryFormat::encode_u32(footer, 0u);
+        footer.append(INDEX_MAGIC, sizeof(INDEX_MAGIC));
+        this->_file.seekp(this->_end);
+        this->_file.write(footer.data(), footer.size());
+    }
+    this->_file.close();
+}
+
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+
+
+unsigned
+rfn::Archive::find(const std::string& name)
+{
+    boost::mutex::scoped_lock guard(this->_lock);
+    std::map<std::string, unsigned>::const_iterator it = this->_ids.find(name);
+    return (it == this->_ids.end()) ? npos : it->second;
+}
+
+bool
+rfn::Archive::contains(const std::string& name, const rfn::Archive::Kind kind)
+{
+    boost::mutex::scoped_lock guard(this->_lock);
+    std::map<std::string, unsigned>::const_iterator it = this->_ids.find(name);
+    if (it == this->_ids.end()) {
+        return false;
+    }
+    for (size_t k = 0; k < this->_index.size(); ++k) {
+        if (this->_index[k].run == it->second && this->_index[k].kind ==
+            (boost::uint32_t)kind)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+unsigned
+rfn::Archive::add(const rfn::Archive::Run& run)
+{
+    boost::mutex::scoped_lock guard(this->_lock);
+    std::map<std::string, unsigned>::const_iterator it =
+        this->_ids.find(run.name);
+    if (it != this->_ids.end()) {
+        return it->second;
+    }
+    const unsigned id = (unsigned)this->_runs.size();
+    std::string payload;
+    BinaryFormat::encode_u32(payload, (boost::uint32_t)run.name.size());
+    payload.append(run.name);
+    BinaryFormat::encode_u32(payload, run.seed);
+    BinaryFormat::encode_f64(payload, run.connectivity);
+    BinaryFormat::encode_u32(payload, run.nodes_in);
+    BinaryFormat::encode_u32(payload, run.nodes_middle);
+    BinaryFormat::encode_u32(payload, run.nodes_out);
+    for (size_t k = 0; k < run.pattern.size(); ++k) {
+        BinaryFormat::encode_f64(payload, run.pattern[k]);
+    }
+    this->write(run_record, id, 0u, payload);
+    this->_runs.push_back(run);
+    this->_ids[run.name] = id;
+    return id;
+}
+
+/*
+ * The payload is encoded before the archive is locked.
+ */
+void
+rfn::Archive::append(const rfn::Archive::Record& record)
+{
+    std::string payload;
+    payload.reserve(24 + record.degrees.size() + 2 * record.targets.size());
+    BinaryFormat::encode_f64(payload, record.flow_error);
+    BinaryFormat::encode_f64(payload, record.robustness);
+    BinaryFormat::encode_u32(payload, (boost::uint32_t)record.degrees.size());
+    BinaryFormat::encode_u32(payload, (boost::uint32_t)record.targets.size());
+    size_t k = 0;
+    for (k = 0; k < record.degrees.size(); ++k) {
+        BinaryFormat::encode_varint(payload, record.degrees[k]);
+    }
+    boost::uint32_t previous = 0u;
+    size_t first = 0;
+    for (unsigned s = 0; s < record.degrees.size(); ++s) {
+        previous = 0u;
+        for (k = first; k < first + record.degrees[s]; ++k) {
+            BinaryFormat::encode_varint(payload, record.targets[k] - previous);
+            previous = record.targets[k];
+        }
+        first += record.degrees[s];
+    }
+    boost::mutex::scoped_lock guard(this->_lock);
+    this->write(record.kind, record.run, record.time, payload);
+}
+
+void
+rfn::Archive::sync()
+{
+    boost::mutex::scoped_lock guard(this->_lock);
+    this->_file.flush();
+    const int fd = ::open(this->_path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        std::cerr << "Warning: Cannot flush archive '" << this->_path
+            << "' to the disk." << std::endl;
+        return;
+    }
+    ::fsync(fd);
+    ::close(fd);
+}
+
+void
+rfn::Archive::read(const rfn::Archive::Entry& entry,
+    rfn::Archive::Record& record)
+{
+    if (entry.kind == run_record) {
+        std::cerr << "Record at " << entry.offset << " of '" << this->_path
+            << "' describes a run. Aborting." << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+    std::string payload;
+    this->read_payload(entry, payload);
+    size_t pos = 0;
+    record.run = entry.run;
+    record.kind = (Kind)entry.kind;
+    record.time = entry.time;
+    record.flow_error = BinaryFormat::decode_f64(payload, pos);
+    record.robustness = BinaryFormat::decode_f64(payload, pos);
+    record.degrees.resize(BinaryFormat::decode_u32(payload, pos));
+    record.targets.resize(BinaryFormat::decode_u32(payload, pos));
+    size_t k = 0;
+    for (k = 0; k < record.degrees.size(); ++k) {
+        record.degrees[k] = BinaryFormat::decode_varint(payload, pos);
+    }
+    size_t first = 0;
+    boost::uint32_t previous = 0u;
+    for (unsigned s = 0; s < record.degrees.size(); ++s) {
+        previous = 0u;
+        for (k = first; k < first + record.degrees[s]
+            && k < record.targets.size(); ++k)
+        {
+            previous += BinaryFormat::decode_varint(payload, pos);
+            record.targets[k] = previous;
+        }
+        first += record.degrees[s];
+    }
+}
+
+/*
+ * Binary search in the sorted index, a linear search in the unsorted index of
+ * an archive that is being written.
+ */
+bool
+rfn::Archive::read(const std::string& name, const rfn::Archive::Kind kind,
+    const boost::uint64_t time, rfn::Archive::Record& record)
+{
+    const unsigned id = this->find(name);
+    if (id == npos) {
+        return false;
+    }
+    if (this->_writable) {
+        // the writer may append to the index meanwhile, hence the entry is
+        // copied under the lock, which 'read_payload' takes itself
+        Entry entry;
+        bool found = false;
+        {
+            boost::mutex::scoped_lock guard(this->_lock);
+            for (size_t k = this->_index.size(); k-- > 0 && !found;) {
+                if (this->_index[k].run == id && this->_index[k].kind ==
+                    (boost::uint32_t)kind && this->_index[k].time == time)
+                {
+                    entry = this->_index[k];
+                    found = true;
+                }
+            }
+        }
+        if (found) {
+            this->read(entry, record);
+        }
+        return found;
+    }
+    Entry key;
+    key.run = id;
+    key.kind = kind;
+    key.time = time;
+    std::vector<Entry>::const_iterator it = std::upper_bound(
+        this->_index.begin(), this->_index.end(), key,
+        &rfn::Archive::precedes);
+    if (it == this->_index.begin()) {
+        return false;
+    }
+    --it;
+    if (it->run != id || it->kind != (boost::uint32_t)kind
+        || it->time != time)
+    {
+        return false;
+    }
+    this->read(*it, record);
+    return true;
+}
+
+
+/*******************************************************************************
+ * Internal Functions
+ ******************************************************************************/
+
+
+/*
+ * A valid trailer ends the file and its index, which matches the checksum in
+ * the trailer, ends right before it, anything else means that the last writer
+ * did not close the archive.
+ */
+void
+rfn::Archive::load()
+{
+    const boost::uint64_t size = bfsys::file_size(this->_path);
+    std::string buffer(HEADER_SIZE, '\0');
+    this->_file.seekg(0);
+    this->_file.read(&buffer[0], HEADER_SIZE);
+    size_t pos = sizeof(FILE_MAGIC);
+    this->_version = BinaryFormat::decode_u32(buffer, pos);
+    if (!this->_file || std::memcmp(buffer.data(), FILE_MAGIC,
+        sizeof(FILE_MAGIC)) != 0 || this->_version > VERSION)
+    {
+        std::cerr << "'" << this->_path << "' is not a readable archive."
+            " Aborting." << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+    bool indexed = false;
+    boost::uint64_t offset = 0u;
+    boost::uint64_t count = 0u;
+    boost::uint32_t sum = 0u;
+    if (size >= HEADER_SIZE + TRAILER_SIZE) {
+        buffer.assign(TRAILER_SIZE, '\0');
+        this->_file.seekg(size - TRAILER_SIZE);
+        this->_file.read(&buffer[0], TRAILER_SIZE);
+        pos = 0;
+        offset = BinaryFormat::decode_u64(buffer, pos);
+        count = BinaryFormat::decode_u64(buffer, pos);
+        sum = BinaryFormat::decode_u32(buffer, pos);
+        indexed = this->_file && std::memcmp(buffer.data() + 24, INDEX_MAGIC,
+            sizeof(INDEX_MAGIC)) == 0 && offset >= HEADER_SIZE
+            && offset + count * ENTRY_SIZE + TRAILER_SIZE == size;
+    }
+    if (indexed) {
+        buffer.assign(count * ENTRY_SIZE, '\0');
+        this->_file.seekg(offset);
+        this->_file.read(&buffer[0], buffer.size());
+        indexed = this->_file && (this->_version < 2u || sum ==
+            BinaryFormat::checksum(buffer.data(), buffer.size()));
+    }
+    if (!indexed) {
+        this->_file.clear();
+        this->scan(size);
+    }
+    else {
+        this->_index.resize(count);
+        pos = 0;
+        for (boost::uint64_t k = 0; k < count; ++k) {
+            this->_index[k].run = BinaryFormat::decode_u32(buffer, pos);
+            this->_index[k].kind = BinaryFormat::decode_u32(buffer, pos);
+            this->_index[k].time = BinaryFormat::decode_u64(buffer, pos);
+            this->_index[k].offset = BinaryFormat::decode_u64(buffer, pos);
+            this->_index[k].size = BinaryFormat::decode_u64(buffer, pos);
+        }
+        // the old index and trailer are cut off before new records take
+        // their place, a writer killed meanwhile leaves no stale trailer
+        this->_end = offset;
+        if (this->_writable) {
+            this->truncate(offset);
+            this->_modified = true;
+        }
+    }
+    // run descriptions
+    std::string payload;
+    for (size_t k = 0; k < this->_index.size(); ++k) {
+        if (this->_index[k].kind != run_record) {
+            continue;
+        }
+        if (this->_index[k].run != this->_runs.size()) {
+            std::cerr << "'" << this->_path << "' has an inconsistent index."
+                " Aborting." << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        this->read_payload(this->_index[k], payload);
+        this->_runs.push_back(Run());
+        decode(payload, this->_runs.back());
+        this->_ids[this->_runs.back().name] = this->_index[k].run;
+    }
+}
+
+/*
+ * Everything after the last complete record is discarded, when writing it is
+ * cut off. A record is complete if its payload matches its checksum.
+ */
+void
+rfn::Archive::scan(const boost::uint64_t size)
+{
+    std::string header(RECORD_HEADER_SIZE, '\0');
+    boost::uint64_t offset = HEADER_SIZE;
+    Entry entry;
+    size_t pos = 0;
+    boost::uint32_t length = 0u;
+    std::string payload;
+    while (offset + RECORD_HEADER_SIZE <= size) {
+        this->_file.seekg(offset);
+        this->_file.read(&header[0], RECORD_HEADER_SIZE);
+        if (!this->_file || std::memcmp(header.data(), RECORD_MAGIC,
+            sizeof(RECORD_MAGIC)) != 0)
+        {
+            break;
+        }
+        pos = sizeof(RECORD_MAGIC);
+        entry.kind = BinaryFormat::decode_u32(header, pos);
+        entry.run = BinaryFormat::decode_u32(header, pos);
+        length = BinaryFormat::decode_u32(header, pos);
+        entry.time = BinaryFormat::decode_u64(header, pos);
+        entry.offset = offset;
+        entry.size = RECORD_HEADER_SIZE + (boost::uint64_t)length;
+        if (offset + entry.size > size) {
+            break;
+        }
+        if (this->_version >= 2u) {
+            payload.assign(length, '\0');
+            if (length > 0) {
+                this->_file.read(&payload[0], length);
+            }
+            if (!this->_file || !this->intact(header, payload)) {
+                break;
+            }
+        }
+        this->_index.push_back(entry);
+        offset += entry.size;
+    }
+    this->_file.clear();
+    this->_end = offset;
+    this->_modified = true;
+    if (this->_writable && offset < size) {
+        this->truncate(offset);
+    }
+}
+
+void
+rfn::Archive::truncate(const boost::uint64_t size)
+{
+    this->_file.close();
+    bfsys::resize_file(this->_path, size);
+    this->_file.open(this->_path, std::ios::in | std::ios::out |
+        std::ios::binary);
+    if (!this->_file) {
+        std::cerr << "Cannot reopen archive '" << this->_path << "'. Aborting."
+            << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+}
+
+void
+rfn::Archive::write(const rfn::Archive::Kind kind, const unsigned run,
+    const boost::uint64_t time, const std::string& payload)
+{
+    if (!this->_writable) {
+        std::cerr << "Archive '" << this->_path << "' is read only. Aborting."
+            << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+    std::string header(RECORD_MAGIC, sizeof(RECORD_MAGIC));
+    BinaryFormat::encode_u32(header, kind);
+    BinaryFormat::encode_u32(header, run);
+    BinaryFormat::encode_u32(header, (boost::uint32_t)payload.size());
+    BinaryFormat::encode_u64(header, time);
+    BinaryFormat::encode_u32(header, BinaryFormat::checksum(payload.data(),
+        payload.size()));
+    header.resize(RECORD_HEADER_SIZE, '\0');
+    this->_file.seekp(this->_end);
+    this->_file.write(header.data(), header.size());
+    this->_file.write(payload.data(), payload.size());
+    this->_file.flush();
+    this->_modified = true;
+    Entry entry;
+    entry.run = run;
+    entry.kind = kind;
+    entry.time = time;
+    entry.offset = this->_end;
+    entry.size = header.size() + payload.size();
+    this->_index.push_back(entry);
+    this->_end += entry.size;
+}
+
+void
+rfn::Archive::read_payload(const rfn::Archive::Entry& entry,
+    std::string& payload)
+{
+    boost::mutex::scoped_lock guard(this->_lock);
+    std::string header(RECORD_HEADER_SIZE, '\0');
+    payload.assign(entry.size - RECORD_HEADER_SIZE, '\0');
+    this->_file.seekg(entry.offset);
+    this->_file.read(&header[0], RECORD_HEADER_SIZE);
+    if (!payload.empty()) {
+        this->_file.read(&payload[0], payload.size());
+    }
+    if (!this->_file) {
+        std::cerr << "Cannot read record at " << entry.offset << " of '"
+            << this->_path << "'. Aborting." << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+    if (this->_version >= 2u && !this->intact(header, payload)) {
+        std::cerr << "Record at " << entry.offset << " of '" << this->_path
+            << "' is corrupt. Aborting." << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+}
+
+bool
+rfn::Archive::intact(const std::string& header, const std::string& payload)
+    const
+{
+    size_t pos = 24;
+    return BinaryFormat::decode_u32(header, pos) ==
+        BinaryFormat::checksum(payload.data(), payload.size());
+}
+
+void
+rfn::Archive::decode(const std::string& payload, rfn::Archive::Run& run)
+{
+    size_t pos = 0;
+    const boost::uint32_t length = BinaryFormat::decode_u32(payload, pos);
+    run.name = payload.substr(std::min(pos, payload.size()), length);
+    pos += length;
+    run.seed = BinaryFormat::decode_u32(payload, pos);
+    run.connectivity = BinaryFormat::decode_f64(payload, pos);
+    run.nodes_in = BinaryFormat::decode_u32(payload, pos);
+    run.nodes_middle = BinaryFormat::decode_u32(payload, pos);
+    run.nodes_out = BinaryFormat::decode_u32(payload, pos);
+    run.pattern.resize(run.nodes_out * run.nodes_in);
+    for (size_t k = 0; k < run.pattern.size(); ++k) {
+        run.pattern[k] = BinaryFormat::decode_f64(payload, pos);
+    }
+}
+
+bool
+rfn::Archive::precedes(const rfn::Archive::Entry& a,
+    const rfn::Archive::Entry& b)
+{
+    if (a.run != b.run) {
+        return a.run < b.run;
+    }
+    if (a.kind != b.kind) {
+        return a.kind < b.kind;
+    }
+    return a.time < b.time;
+}
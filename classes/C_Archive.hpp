@@ -0,0 +1,207 @@
+/*******************************************************************************
+ * filename:    C_Archive.hpp
+ * description: Single file archive of the snapshots of many evolutions
+ * author:      agent
+ * created:     2026-10-17
+ * copyright:   Jacobs University Bremen. All rights reserved.
+ *******************************************************************************
+ * With '--archive <file>' the snapshots, the intermediate '_flow' and the
+ * '_final' state of every network are appended to one file instead of one
+ * '.dat' file each. All numbers are stored little-endian with fixed widths,
+ * doubles as IEEE 754 bit patterns, encoded as in 'C_BinaryStream.hpp':
+ *
+ *  header   32 bytes: "RFNARCHV", version, header size, zero padding
+ *  record   32 byte record header: "RFNR", kind, run, payload size, time,
+ *           CRC-32 of the payload, zero padding; followed by the payload
+ *  index    one 32 byte entry per record: run, kind, time, offset, size
+ *  trailer  32 bytes: index offset, number of entries, CRC-32 of the index
+ *           followed by four zero bytes, "RFNINDEX"
+ *
+ * The first record of a run describes it once: name, seed, connectivity,
+ * layer sizes and ideal pattern. A state record holds the flow error, the
+ * robustness (negative if not applicable) and the links as two columns, the
+ * out-degree of every node up to the last middle node and the targets of all
+ * links in order of their source, each target as the difference to the
+ * previous target of the same source. Both columns are unsigned LEB128
+ * variable length integers.
+ *
+ * Records are written as they arrive and flushed, the index and trailer when
+ * the archive is closed. Opening an existing archive for appending cuts off
+ * its index and trailer, the new ones cover all records, thus readers only
+ * ever read the trailer at the end of the file and then seek to the record
+ * they want.
+ * If a writer was killed, opening the archive recovers all complete records by
+ * following the record headers from the start, up to the first record whose
+ * payload does not match its checksum. Version 1 archives have neither
+ * checksum, records appended to them carry one that is not checked. One
+ * process at a time may write to an archive, the threads of that process
+ * share it.
+ ******************************************************************************/
+
+
+#ifndef _C_ARCHIVE_HPP
+#define	_C_ARCHIVE_HPP
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+
+// std
+#include <string>
+#include <vector>
+#include <map>
+
+// boost
+#include <boost/cstdint.hpp>
+#include <boost/thread/mutex.hpp>
+
+// project
+#include "common_definitions.hpp"
+
+
+/*******************************************************************************
+ * Declarations
+ ******************************************************************************/
+
+
+namespace rfn {
+
+    class Archive {
+
+    public:
+        enum Kind {
+            run_record,
+            snapshot_record,
+            flow_record,
+            final_record
+        };
+        static const boost::uint32_t VERSION = 2u;
+        static const unsigned HEADER_SIZE = 32u;
+        static const unsigned RECORD_HEADER_SIZE = 32u;
+        static const unsigned ENTRY_SIZE = 32u;
+        static const unsigned TRAILER_SIZE = 32u;
+        // id of an unknown run
+        static const unsigned npos = ~0u;
+
+        // description of an evolution, constant over all of its records
+        struct Run {
+            std::string name;
+            unsigned seed;
+            double connectivity;
+            unsigned nodes_in;
+            unsigned nodes_middle;
+            unsigned nodes_out;
+            // ideal pattern, 'nodes_out' rows of 'nodes_in' values
+            std::vector<double> pattern;
+        };
+
+        // state of a network at 'time'
+        struct Record {
+            unsigned run;
+            Kind kind;
+            boost::uint64_t time;
+            double flow_error;
+            double robustness;
+            // out-degree of every node up to the last middle node
+            std::vector<unsigned> degrees;
+            // targets of all links ordered by source and target
+            std::vector<unsigned> targets;
+        };
+
+        // position of a record in the file
+        struct Entry {
+            boost::uint32_t run;
+            boost::uint32_t kind;
+            boost::uint64_t time;
+            boost::uint64_t offset;
+            boost::uint64_t size;
+        };
+
+    protected:
+        /* Data Members */
+        static const char FILE_MAGIC[8];
+        static const char RECORD_MAGIC[4];
+        static const char INDEX_MAGIC[8];
+        std::string _path;
+        bfsys::fstream _file;
+        bool _writable;
+        // format version of the file
+        boost::uint32_t _version;
+        // whether the index on disk is out of date
+        bool _modified;
+        // end of the last complete record
+        boost::uint64_t _end;
+        std::vector<Run> _runs;
+        std::map<std::string, unsigned> _ids;
+        std::vector<Entry> _index;
+        boost::mutex _lock;
+
+    public:
+        /* Constructors & Destructor */
+        // open 'path' for reading or, if 'writable', for appending, a missing
+        // file is created
+        Archive(const std::string& path, const bool writable);
+        // writes index and trailer of a writable archive
+        ~Archive();
+
+        /* Member Functions */
+        // id of the run 'name' or 'npos'
+        unsigned find(const std::string& name);
+        // whether the run 'name' has a record of 'kind'
+        bool contains(const std::string& name, const Kind kind);
+        // id of 'run', which is described in the archive on first use
+        unsigned add(const Run& run);
+        // append a state record of a run returned by 'add'
+        void append(const Record& record);
+        // wait until all appended records are on the disk
+        void sync();
+        // _runs get method
+        const std::vector<Run>& runs() const
+        {
+            return this->_runs;
+        }
+        // _index get method, entries are ordered by run, kind and time
+        // unless the archive is writable
+        const std::vector<Entry>& index() const
+        {
+            return this->_index;
+        }
+        // read the state record of 'entry'
+        void read(const Entry& entry, Record& record);
+        // read the latest record of 'kind' of run 'name' at 'time', returns
+        // false if there is none, a binary search unless 'writable'
+        bool read(const std::string& name, const Kind kind,
+            const boost::uint64_t time, Record& record);
+
+    protected:
+        /* Internal Functions */
+        // header, index and run descriptions of an existing file
+        void load();
+        // follow the record headers from the start of the file
+        void scan(const boost::uint64_t size);
+        // cut the file off after 'size' bytes and reopen it
+        void truncate(const boost::uint64_t size);
+        // write 'payload' as a record at '_end', requires '_lock'
+        void write(const Kind kind, const unsigned run,
+            const boost::uint64_t time, const std::string& payload);
+        // read the payload of 'entry', which has to match its checksum
+        void read_payload(const Entry& entry, std::string& payload);
+        // whether 'payload' matches the checksum in 'header'
+        bool intact(const std::string& header, const std::string& payload)
+            const;
+        // decode a run description
+        static void decode(const std::string& payload, Run& run);
+        // order of index entries for lookups
+        static bool precedes(const Entry& a, const Entry& b);
+
+    private:
+        Archive(const Archive&);
+        Archive& operator=(const Archive&);
+    };
+
+} // namespace rfn
+
+
+#endif // _C_ARCHIVE_HPP
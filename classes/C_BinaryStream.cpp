@@ -0,0 +1,373 @@
+/*******************************************************************************
+ * filename:    C_BinaryStream.cpp
+ * description: Implementation of 'BinaryWriter' and 'BinaryReader' classes
+ * author:      agent
+ * created:     2026-10-17
+ * copyright:   Jacobs University Bremen. All rights reserved.
+ ******************************************************************************/
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+
+// std
+#include <cstring>
+#include <algorithm>
+
+// project
+#include "C_BinaryStream.hpp"
+
+
+/*******************************************************************************
+ * Static Data Members
+ ******************************************************************************/
+
+
+const char rfn::BinaryFormat::PARAMETERS_MAGIC[MAGIC_SIZE] = {'R', 'F', 'N',
+    'P', 'A', 'R', 'A', 'M'};
+const char rfn::BinaryFormat::STATE_MAGIC[MAGIC_SIZE] = {'R', 'F', 'N', 'S',
+    'T', 'A', 'T', 'E'};
+const char rfn::BinaryFormat::CHECKPOINT_MAGIC[MAGIC_SIZE] = {'R', 'F', 'N',
+    'C', 'H', 'K', 'P', 'T'};
+
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+
+
+bool
+rfn::BinaryFormat::little_endian()
+{
+    const boost::uint32_t one = 1u;
+    return *reinterpret_cast<const unsigned char*>(&one) == 1u;
+}
+
+boost::uint32_t
+rfn::BinaryFormat::checksum(const char* const data, const size_t size)
+{
+    boost::crc_32_type crc;
+    crc.process_bytes(data, size);
+    return crc.checksum();
+}
+
+bool
+rfn::BinaryFormat::intact(const std::string& bytes, const char* const magic)
+{
+    if (bytes.size() < HEADER_SIZE + TRAILER_SIZE
+        || std::memcmp(bytes.data(), magic, MAGIC_SIZE) != 0)
+    {
+        return false;
+    }
+    const size_t body = bytes.size() - TRAILER_SIZE;
+    return decode(bytes.data() + body, TRAILER_SIZE) ==
+        checksum(bytes.data(), body);
+}
+
+void
+rfn::BinaryFormat::encode(const boost::uint64_t value, const unsigned size,
+    char* const bytes)
+{
+    for (unsigned b = 0; b < size; ++b) {
+        bytes[b] = (char)((value >> (8 * b)) & 0xFFu);
+    }
+}
+
+boost::uint64_t
+rfn::BinaryFormat::decode(const char* const bytes, const unsigned size)
+{
+    boost::uint64_t value = 0u;
+    for (unsigned b = 0; b < size; ++b) {
+        value |= (boost::uint64_t)(unsigned char)bytes[b] << (8 * b);
+    }
+    return value;
+}
+
+void
+rfn::BinaryFormat::encode_u32(std::string& out, const boost::uint32_t value)
+{
+    char bytes[4];
+    encode(value, 4, bytes);
+    out.append(bytes, 4);
+}
+
+void
+rfn::BinaryFormat::encode_u64(std::string& out, const boost::uint64_t value)
+{
+    char bytes[8];
+    encode(value, 8, bytes);
+    out.append(bytes, 8);
+}
+
+void
+rfn::BinaryFormat::encode_f64(std::string& out, const double value)
+{
+    boost::uint64_t bits = 0u;
+    std::memcpy(&bits, &value, sizeof(bits));
+    encode_u64(out, bits);
+}
+
+void
+rfn::BinaryFormat::encode_varint(std::string& out, boost::uint32_t value)
+{
+    while (value >= 0x80u) {
+        out.push_back((char)((value & 0x7Fu) | 0x80u));
+        value >>= 7;
+    }
+    out.push_back((char)value);
+}
+
+boost::uint32_t
+rfn::BinaryFormat::decode_u32(const std::string& in, size_t& pos)
+{
+    char bytes[4] = {0, 0, 0, 0};
+    in.copy(bytes, 4, std::min(pos, in.size()));
+    pos += 4;
+    return (boost::uint32_t)decode(bytes, 4);
+}
+
+boost::uint64_t
+rfn::BinaryFormat::decode_u64(const std::string& in, size_t& pos)
+{
+    char bytes[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    in.copy(bytes, 8, std::min(pos, in.size()));
+    pos += 8;
+    return decode(bytes, 8);
+}
+
+double
+rfn::BinaryFormat::decode_f64(const std::string& in, size_t& pos)
+{
+    const boost::uint64_t bits = decode_u64(in, pos);
+    double value = 0.0;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+boost::uint32_t
+rfn::BinaryFormat::decode_varint(const std::string& in, size_t& pos)
+{
+    boost::uint32_t value = 0u;
+    unsigned shift = 0u;
+    unsigned char byte = 0x80u;
+    while ((byte & 0x80u) && pos < in.size() && shift < 35u) {
+        byte = (unsigned char)in[pos++];
+        value |= (boost::uint32_t)(byte & 0x7Fu) << shift;
+        shift += 7u;
+    }
+    return value;
+}
+
+
+/*******************************************************************************
+ * Constructors & Destructor
+ ******************************************************************************/
+
+
+rfn::BinaryWriter::BinaryWriter(std::ostream& out, const char* const magic):
+    _out(out),
+    _crc()
+{
+    this->put(magic, MAGIC_SIZE);
+    this->put_u32(VERSION);
+}
+
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+
+
+void
+rfn::BinaryWriter::put_u16(const boost::uint16_t value)
+{
+    char bytes[2];
+    encode(value, 2, bytes);
+    this->put(bytes, 2);
+}
+
+void
+rfn::BinaryWriter::put_u32(const boost::uint32_t value)
+{
+    char bytes[4];
+    encode(value, 4, bytes);
+    this->put(bytes, 4);
+}
+
+void
+rfn::BinaryWriter::put_u64(const boost::uint64_t value)
+{
+    char bytes[8];
+    encode(value, 8, bytes);
+    this->put(bytes, 8);
+}
+
+void
+rfn::BinaryWriter::put_f64(const double value)
+{
+    boost::uint64_t bits = 0u;
+    std::memcpy(&bits, &value, sizeof(bits));
+    this->put_u64(bits);
+}
+
+void
+rfn::BinaryWriter::put_string(const std::string& value)
+{
+    this->put_u32((boost::uint32_t)value.size());
+    this->put(value.data(), value.size());
+}
+
+void
+rfn::BinaryWriter::finish()
+{
+    char bytes[4];
+    encode(this->_crc.checksum(), 4, bytes);
+    this->_out.write(bytes, 4);
+}
+
+
+/*******************************************************************************
+ * Internal Functions
+ ******************************************************************************/
+
+
+void
+rfn::BinaryWriter::put(const char* const bytes, const unsigned size)
+{
+    this->_out.write(bytes, size);
+    this->_crc.process_bytes(bytes, size);
+}
+
+
+/*******************************************************************************
+ * Constructors & Destructor
+ ******************************************************************************/
+
+
+rfn::BinaryReader::BinaryReader(std::istream& in, const char* const magic,
+    const unsigned long_size, const bool swapped):
+    _in(in),
+    _crc(),
+    _legacy(true),
+    _version(0u),
+    _long_size(long_size),
+    _swapped(swapped),
+    _end()
+{
+    const std::streampos start = this->_in.tellg();
+    this->_in.seekg(0, std::ios::end);
+    this->_end = this->_in.tellg();
+    this->_in.seekg(start);
+    char bytes[MAGIC_SIZE];
+    this->_in.read(bytes, MAGIC_SIZE);
+    if (this->_in && std::memcmp(bytes, magic, MAGIC_SIZE) == 0) {
+        this->_crc.process_bytes(bytes, MAGIC_SIZE);
+        this->_legacy = false;
+        this->_version = this->get_u32();
+        this->_end -= TRAILER_SIZE;
+    }
+    else {
+        this->_in.clear();
+        this->_in.seekg(start);
+    }
+}
+
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+
+
+boost::uint16_t
+rfn::BinaryReader::get_u16()
+{
+    return (boost::uint16_t)this->get(2);
+}
+
+boost::uint32_t
+rfn::BinaryReader::get_u32()
+{
+    return (boost::uint32_t)this->get(4);
+}
+
+boost::uint64_t
+rfn::BinaryReader::get_u64()
+{
+    return this->get((this->_legacy) ? this->_long_size : 8);
+}
+
+double
+rfn::BinaryReader::get_f64()
+{
+    const boost::uint64_t bits = this->get(8);
+    double value = 0.0;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/*
+ * A length beyond the end of the stream yields what is left.
+ */
+std::string
+rfn::BinaryReader::get_string()
+{
+    const boost::uint32_t size = this->get_u32();
+    const std::streampos pos = this->_in.tellg();
+    if (!this->_in || pos < 0 || pos >= this->_end) {
+        return std::string();
+    }
+    std::string value((size_t)std::min((std::streamoff)size,
+        (std::streamoff)(this->_end - pos)), '\0');
+    if (!value.empty()) {
+        this->_in.read(&value[0], value.size());
+        if (!this->_legacy) {
+            this->_crc.process_bytes(value.data(), value.size());
+        }
+    }
+    return value;
+}
+
+bool
+rfn::BinaryReader::at_end()
+{
+    return !this->_in || this->_in.tellg() >= this->_end;
+}
+
+bool
+rfn::BinaryReader::finish()
+{
+    if (!this->_in) {
+        return false;
+    }
+    if (this->_legacy) {
+        return true;
+    }
+    char bytes[4];
+    this->_in.read(bytes, 4);
+    return this->_in && decode(bytes, 4) == this->_crc.checksum();
+}
+
+
+/*******************************************************************************
+ * Internal Functions
+ ******************************************************************************/
+
+
+/*
+ * Legacy streams are in the byte order of the machine that wrote them.
+ */
+boost::uint64_t
+rfn::BinaryReader::get(const unsigned size)
+{
+    char bytes[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    this->_in.read(bytes, size);
+    if (!this->_legacy) {
+        this->_crc.process_bytes(bytes, size);
+    }
+    if (this->_legacy && (little_endian() == this->_swapped)) {
+        std::reverse(bytes, bytes + size);
+    }
+    return decode(bytes, size);
+}
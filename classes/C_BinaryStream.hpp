@@ -0,0 +1,172 @@
+/*******************************************************************************
+ * filename:    C_BinaryStream.hpp
+ * description: Portable binary encoding of parameter and result files
+ * author:      agent
+ * created:     2026-10-17
+ * copyright:   Jacobs University Bremen. All rights reserved.
+ *******************************************************************************
+ * Parameter and result files start with an eight byte magic and a 32 bit
+ * format version and end with the CRC-32 of all preceding bytes. In between
+ * every value has a fixed width and is stored little-endian, doubles as their
+ * IEEE 754 bit pattern, thus the files are the same on every machine. The
+ * archive of 'C_Archive.hpp' encodes its records with the same functions.
+ *
+ * The values are written and read in the same order and with the same widths
+ * as in the legacy format, which had neither magic nor checksum and stored
+ * values in the byte order and widths of the machine. A reader that does not
+ * find the magic rewinds and decodes the legacy format instead, given the
+ * width of 'unsigned long' and the byte order of the machine that wrote it,
+ * by default those of this machine.
+ ******************************************************************************/
+
+
+#ifndef _C_BINARYSTREAM_HPP
+#define	_C_BINARYSTREAM_HPP
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+
+// std
+#include <istream>
+#include <ostream>
+#include <string>
+
+// boost
+#include <boost/cstdint.hpp>
+#include <boost/crc.hpp>
+
+
+/*******************************************************************************
+ * Declarations
+ ******************************************************************************/
+
+
+namespace rfn {
+
+    class BinaryFormat {
+
+    public:
+        static const boost::uint32_t VERSION = 1u;
+        static const unsigned MAGIC_SIZE = 8u;
+        // bytes in front of the first value
+        static const unsigned HEADER_SIZE = 12u;
+        // bytes after the last value
+        static const unsigned TRAILER_SIZE = 4u;
+        // magic of 'parameters.dat'
+        static const char PARAMETERS_MAGIC[MAGIC_SIZE];
+        // magic of a network state, e.g., '<name>_final.dat'
+        static const char STATE_MAGIC[MAGIC_SIZE];
+        // magic of the checkpoint of an evolution, '<name>.checkpoint'
+        static const char CHECKPOINT_MAGIC[MAGIC_SIZE];
+
+        // whether this machine stores numbers little-endian
+        static bool little_endian();
+        // CRC-32 of 'size' bytes
+        static boost::uint32_t checksum(const char* const data,
+            const size_t size);
+        // whether 'bytes' start with 'magic' and end with their checksum
+        static bool intact(const std::string& bytes, const char* const magic);
+        // the 'size' low bytes of 'value' little-endian
+        static void encode(const boost::uint64_t value, const unsigned size,
+            char* const bytes);
+        static boost::uint64_t decode(const char* const bytes,
+            const unsigned size);
+        // append a number to 'out'
+        static void encode_u32(std::string& out, const boost::uint32_t value);
+        static void encode_u64(std::string& out, const boost::uint64_t value);
+        static void encode_f64(std::string& out, const double value);
+        // unsigned LEB128 variable length integer
+        static void encode_varint(std::string& out, boost::uint32_t value);
+        // read a number at 'pos' of 'in' and advance 'pos', reading past the
+        // end yields zeros
+        static boost::uint32_t decode_u32(const std::string& in, size_t& pos);
+        static boost::uint64_t decode_u64(const std::string& in, size_t& pos);
+        static double decode_f64(const std::string& in, size_t& pos);
+        static boost::uint32_t decode_varint(const std::string& in,
+            size_t& pos);
+    };
+
+    class BinaryWriter: public BinaryFormat {
+
+    protected:
+        /* Data Members */
+        std::ostream& _out;
+        boost::crc_32_type _crc;
+
+    public:
+        /* Constructors & Destructor */
+        // writes the header
+        BinaryWriter(std::ostream& out, const char* const magic);
+
+        /* Member Functions */
+        void put_u16(const boost::uint16_t value);
+        void put_u32(const boost::uint32_t value);
+        void put_u64(const boost::uint64_t value);
+        void put_f64(const double value);
+        // u32 length followed by the bytes of 'value'
+        void put_string(const std::string& value);
+        // write the checksum, nothing may be written afterwards
+        void finish();
+
+    protected:
+        /* Internal Functions */
+        void put(const char* const bytes, const unsigned size);
+    };
+
+    class BinaryReader: public BinaryFormat {
+
+    protected:
+        /* Data Members */
+        std::istream& _in;
+        boost::crc_32_type _crc;
+        bool _legacy;
+        boost::uint32_t _version;
+        // width of 'unsigned long' in a legacy stream
+        unsigned _long_size;
+        // whether a legacy stream has the other byte order
+        bool _swapped;
+        // end of the values
+        std::streampos _end;
+
+    public:
+        /* Constructors & Destructor */
+        // reads the header or rewinds if there is none
+        BinaryReader(std::istream& in, const char* const magic,
+            const unsigned long_size = sizeof(unsigned long),
+            const bool swapped = false);
+
+        /* Member Functions */
+        // _legacy get method
+        bool legacy() const
+        {
+            return this->_legacy;
+        }
+        // _version get method, 0 for the legacy format
+        boost::uint32_t version() const
+        {
+            return this->_version;
+        }
+        boost::uint16_t get_u16();
+        boost::uint32_t get_u32();
+        // an 'unsigned long' in the legacy format
+        boost::uint64_t get_u64();
+        double get_f64();
+        std::string get_string();
+        // whether all values have been read
+        bool at_end();
+        // whether all reads succeeded and, unless legacy, the checksum matches
+        bool finish();
+
+    protected:
+        /* Internal Functions */
+        // read 'size' bytes and return them as a little-endian number
+        boost::uint64_t get(const unsigned size);
+    };
+
+} // namespace rfn
+
+
+#endif // _C_BINARYSTREAM_HPP
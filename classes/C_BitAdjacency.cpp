@@ -0,0 +1,122 @@
+/*******************************************************************************
+ * filename:    C_BitAdjacency.cpp
+ * description: Implementation of 'BitAdjacency' class
+ * author:      agent
+ * created:     2026-10-17
+ * copyright:   Jacobs University Bremen. All rights reserved.
+ ******************************************************************************/
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+
+// std
+#include <cstddef>
+
+// project
+#include "C_BitAdjacency.hpp"
+
+
+/*******************************************************************************
+ * Static Members
+ ******************************************************************************/
+
+
+const unsigned rfn::BitAdjacency::BITS;
+
+
+/*******************************************************************************
+ * Constructors & Destructor
+ ******************************************************************************/
+
+
+/*
+ * Default constructor
+ */
+rfn::BitAdjacency::BitAdjacency(const unsigned num_vertices):
+    _num_vertices(num_vertices),
+    _words((num_vertices + BITS - 1u) / BITS),
+    _num_edges(0u),
+    _out(),
+    _in()
+{
+    this->_out.assign(this->_num_vertices * this->_words, 0ul);
+    this->_in.assign(this->_num_vertices * this->_words, 0ul);
+}
+
+/*
+ * Destructor
+ */
+rfn::BitAdjacency::~BitAdjacency()
+{}
+
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+
+
+void
+rfn::BitAdjacency::clear_vertex(const unsigned v)
+{
+    const Word out_mask = ~(1ul << (v % BITS));
+    Word* row = &this->_out[v * this->_words];
+    Word bits = 0ul;
+    unsigned w = 0u;
+    unsigned u = 0u;
+    // targets of 'v' lose it as a source and vice versa
+    for (w = 0; w < this->_words; ++w) {
+        bits = row[w];
+        this->_num_edges -= (unsigned)__builtin_popcountl(bits);
+        while (bits != 0ul) {
+            u = w * BITS + (unsigned)__builtin_ctzl(bits);
+            bits &= bits - 1ul;
+            this->_in[u * this->_words + v / BITS] &= out_mask;
+        }
+        row[w] = 0ul;
+    }
+    row = &this->_in[v * this->_words];
+    for (w = 0; w < this->_words; ++w) {
+        bits = row[w];
+        this->_num_edges -= (unsigned)__builtin_popcountl(bits);
+        while (bits != 0ul) {
+            u = w * BITS + (unsigned)__builtin_ctzl(bits);
+            bits &= bits - 1ul;
+            this->_out[u * this->_words + v / BITS] &= out_mask;
+        }
+        row[w] = 0ul;
+    }
+}
+
+/*
+ * The set grows by the targets of its members until it no longer changes,
+ * i.e., at most once per node on the longest shortest path.
+ */
+void
+rfn::BitAdjacency::reachable(Word* const reached) const
+{
+    bool grown = true;
+    Word bits = 0ul;
+    Word const* row = NULL;
+    unsigned w = 0u;
+    while (grown) {
+        grown = false;
+        for (unsigned word = 0; word < this->_words; ++word) {
+            bits = reached[word];
+            while (bits != 0ul) {
+                row = this->out_row(word * BITS + (unsigned)__builtin_ctzl(
+                    bits));
+                bits &= bits - 1ul;
+                for (w = 0; w < this->_words; ++w) {
+                    if (row[w] & ~reached[w]) {
+                        reached[w] |= row[w];
+                        grown = true;
+                    }
+                }
+            }
+        }
+    }
+}
+
@@ -0,0 +1,252 @@
+/*******************************************************************************
+ * filename:    C_BitAdjacency.hpp
+ * description: Bit-packed adjacency matrix of a directed network
+ * author:      agent
+ * created:     2026-10-17
+ * copyright:   Jacobs University Bremen. All rights reserved.
+ *******************************************************************************
+ * Every node has one row of bits for its targets and one for its sources, so
+ * that both out- and in-neighbours are found by scanning machine words and
+ * degrees are population counts. Copying a network copies two contiguous
+ * arrays of words.
+ *
+ * Neighbours are visited in ascending order just like the out- and in-edges of
+ * a 'boost::adjacency_matrix'.
+ ******************************************************************************/
+
+
+#ifndef _C_BITADJACENCY_HPP
+#define	_C_BITADJACENCY_HPP
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+
+// std
+#include <cstddef>
+#include <vector>
+#include <utility>
+
+// boost
+#include <boost/tuple/tuple.hpp>
+
+
+/*******************************************************************************
+ * Declarations
+ ******************************************************************************/
+
+
+namespace rfn {
+
+    class BitAdjacency {
+
+    public:
+        typedef unsigned long Word;
+        static const unsigned BITS = sizeof(Word) * 8u;
+
+        // visits the set bits of a row in ascending order
+        class Iterator {
+
+        protected:
+            /* Data Members */
+            Word const* _row;
+            unsigned _words;
+            unsigned _word;
+            Word _bits;
+
+        public:
+            /* Constructors & Destructor */
+            Iterator():
+                _row(NULL),
+                _words(0u),
+                _word(0u),
+                _bits(0ul)
+            {}
+            Iterator(Word const* const row, const unsigned words,
+                const unsigned word):
+                _row(row),
+                _words(words),
+                _word(word),
+                _bits((word < words) ? row[word] : 0ul)
+            {
+                this->skip();
+            }
+
+            /* Operators */
+            unsigned operator*() const
+            {
+                return this->_word * BITS + (unsigned)__builtin_ctzl(
+                    this->_bits);
+            }
+            Iterator& operator++()
+            {
+                this->_bits &= this->_bits - 1ul;
+                this->skip();
+                return *this;
+            }
+            bool operator==(const Iterator& other) const
+            {
+                return this->_word == other._word
+                    && this->_bits == other._bits;
+            }
+            bool operator!=(const Iterator& other) const
+            {
+                return !(*this == other);
+            }
+
+        protected:
+            /* Internal Functions */
+            void skip()
+            {
+                while (this->_bits == 0ul && this->_word < this->_words) {
+                    ++this->_word;
+                    this->_bits = (this->_word < this->_words) ?
+                        this->_row[this->_word] : 0ul;
+                }
+            }
+
+        }; // class Iterator
+
+        typedef std::pair<Iterator, Iterator> Range;
+
+    protected:
+        /* Data Members */
+        unsigned _num_vertices;
+        unsigned _words;
+        unsigned _num_edges;
+        // bit 'v' of out row 'u' and bit 'u' of in row 'v' mark the link u -> v
+        std::vector<Word> _out;
+        std::vector<Word> _in;
+
+    public:
+        /* Constructors & Destructor */
+        BitAdjacency(const unsigned num_vertices);
+        virtual ~BitAdjacency();
+
+        /* Member Functions */
+        // _num_vertices get method
+        unsigned num_vertices() const
+        {
+            return this->_num_vertices;
+        }
+        // _num_edges get method
+        unsigned num_edges() const
+        {
+            return this->_num_edges;
+        }
+        // _words get method, words per row
+        unsigned words() const
+        {
+            return this->_words;
+        }
+        // whether the link 'u' -> 'v' exists
+        bool edge(const unsigned u, const unsigned v) const
+        {
+            return test(this->out_row(u), v);
+        }
+        // returns whether the link is new
+        bool add_edge(const unsigned u, const unsigned v)
+        {
+            Word& bits = this->_out[u * this->_words + v / BITS];
+            const Word mask = 1ul << (v % BITS);
+            if (bits & mask) {
+                return false;
+            }
+            bits |= mask;
+            this->_in[v * this->_words + u / BITS] |= 1ul << (u % BITS);
+            ++this->_num_edges;
+            return true;
+        }
+        // returns whether the link existed
+        bool remove_edge(const unsigned u, const unsigned v)
+        {
+            Word& bits = this->_out[u * this->_words + v / BITS];
+            const Word mask = 1ul << (v % BITS);
+            if (!(bits & mask)) {
+                return false;
+            }
+            bits &= ~mask;
+            this->_in[v * this->_words + u / BITS] &= ~(1ul << (u % BITS));
+            --this->_num_edges;
+            return true;
+        }
+        // add the link 'u' -> 'v' if it is absent, remove it otherwise
+        void flip_edge(const unsigned u, const unsigned v)
+        {
+            if (!this->add_edge(u, v)) {
+                this->remove_edge(u, v);
+            }
+        }
+        // remove all links of node 'v'
+        void clear_vertex(const unsigned v);
+        unsigned out_degree(const unsigned v) const
+        {
+            return count(this->out_row(v), this->_words);
+        }
+        unsigned in_degree(const unsigned v) const
+        {
+            return count(this->in_row(v), this->_words);
+        }
+        // targets of 'v' in ascending order
+        Range out_neighbours(const unsigned v) const
+        {
+            return Range(Iterator(this->out_row(v), this->_words, 0u),
+                Iterator(this->out_row(v), this->_words, this->_words));
+        }
+        // sources of 'v' in ascending order
+        Range in_neighbours(const unsigned v) const
+        {
+            return Range(Iterator(this->in_row(v), this->_words, 0u),
+                Iterator(this->in_row(v), this->_words, this->_words));
+        }
+        Word const* out_row(const unsigned v) const
+        {
+            return &this->_out[v * this->_words];
+        }
+        Word const* in_row(const unsigned v) const
+        {
+            return &this->_in[v * this->_words];
+        }
+        // extend the set of nodes 'reached', one bit per node, by all nodes
+        // that can be reached from it
+        void reachable(Word* const reached) const;
+        // whether bit 'v' of 'row' is set
+        static bool test(Word const* const row, const unsigned v)
+        {
+            return (row[v / BITS] >> (v % BITS)) & 1ul;
+        }
+        // first bit set in 'row' at or after 'v', 'words * BITS' if none
+        static unsigned next(Word const* const row, const unsigned words,
+            const unsigned v)
+        {
+            unsigned w = v / BITS;
+            if (w >= words) {
+                return words * BITS;
+            }
+            Word bits = row[w] & (~0ul << (v % BITS));
+            while (bits == 0ul) {
+                if (++w == words) {
+                    return words * BITS;
+                }
+                bits = row[w];
+            }
+            return w * BITS + (unsigned)__builtin_ctzl(bits);
+        }
+        // number of bits set in 'words' words
+        static unsigned count(Word const* const row, const unsigned words)
+        {
+            unsigned num = 0u;
+            for (unsigned w = 0; w < words; ++w) {
+                num += (unsigned)__builtin_popcountl(row[w]);
+            }
+            return num;
+        }
+
+    }; // class BitAdjacency
+
+} // namespace rfn
+
+
+#endif	// _C_BITADJACENCY_HPP
@@ -0,0 +1,414 @@
+/*******************************************************************************
+ * filename:    C_ComponentSolver.cpp
+ * description: Implementation of 'ComponentSolver' class
+ * author:      agent
+ * created:     2026-10-17
+ * copyright:   Jacobs University Bremen. All rights reserved.
+ ******************************************************************************/
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+
+// std
+#include <algorithm>
+
+// gsl
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_permutation.h>
+
+// project
+#include "C_ComponentSolver.hpp"
+#include "C_LinearAlgebra.hpp"
+#include "C_Profile.hpp"
+
+
+/*******************************************************************************
+ * Constructors & Destructor
+ ******************************************************************************/
+
+
+/*
+ * Default constructor
+ */
+rfn::ComponentSolver::ComponentSolver(rfn::ParameterManager* const parameters):
+    _parameters(parameters),
+    _component(),
+    _start(),
+    _nodes(),
+    _pos(),
+    _order(),
+    _low(),
+    _next(),
+    _path(),
+    _stack(),
+    _num(0u),
+    _first(),
+    _targets(),
+    _weight(),
+    _local(),
+    _slot(),
+    _block(NULL),
+    _rhs(NULL),
+    _permutation(NULL),
+    _sparse()
+{}
+
+/*
+ * Destructor
+ */
+rfn::ComponentSolver::~ComponentSolver()
+{
+    if (this->_block != NULL) {
+        gsl_matrix_free(this->_block);
+        this->_block = NULL;
+    }
+    if (this->_rhs != NULL) {
+        gsl_matrix_free(this->_rhs);
+        this->_rhs = NULL;
+    }
+    if (this->_permutation != NULL) {
+        gsl_permutation_free(this->_permutation);
+        this->_permutation = NULL;
+    }
+    this->_parameters = NULL; // singleton destroys itself
+}
+
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+
+
+int
+rfn::ComponentSolver::solve(rfn::Adjacency const* const network,
+    rfn::Matrix* const flow)
+{
+    int status = this->factorise(network);
+    if (status == 0) {
+        status = this->propagate(flow);
+    }
+    return status;
+}
+
+/*
+ * Components, downstream links and the factors of all cyclic blocks only
+ * depend on the network, the right hand sides can then be solved in any
+ * portions.
+ */
+int
+rfn::ComponentSolver::factorise(rfn::Adjacency const* const network)
+{
+    rfn::Profile::Scope scope(rfn::Profile::build);
+    const unsigned n = network->num_vertices();
+    this->_num = this->strong_components(network);
+    // sort nodes by component
+    this->_start.assign(this->_num + 1, 0u);
+    this->_nodes.resize(n);
+    unsigned v = 0u;
+    unsigned c = 0u;
+    for (v = 0; v < n; ++v) {
+        ++this->_start[this->_component[v] + 1];
+    }
+    for (c = 0; c < this->_num; ++c) {
+        this->_start[c + 1] += this->_start[c];
+    }
+    this->_pos.assign(this->_start.begin(), this->_start.end() - 1);
+    for (v = 0; v < n; ++v) {
+        this->_nodes[this->_pos[this->_component[v]]++] = v;
+    }
+    // links that leave the component of their source, by position
+    rfn::Adjacency::Iterator oeit, oeit_end;
+    this->_weight.resize(n);
+    this->_first.resize(n + 1);
+    this->_targets.clear();
+    for (unsigned p = 0; p < n; ++p) {
+        v = this->_nodes[p];
+        this->_first[p] = (unsigned)this->_targets.size();
+        this->_weight[p] = 1.0 / (double)network->out_degree(v);
+        for (boost::tie(oeit, oeit_end) = network->out_neighbours(v);
+            oeit != oeit_end; ++oeit)
+        {
+            if (this->_component[*oeit] != this->_component[v]) {
+                this->_targets.push_back(*oeit);
+            }
+        }
+    }
+    this->_first[n] = (unsigned)this->_targets.size();
+    // Tarjan's algorithm numbers components in reverse topological order
+    this->_slot.resize(this->_num);
+    unsigned blocks = 0u;
+    int status = 0;
+    for (c = this->_num; c-- > 0 && status == 0;) {
+        if (this->_start[c + 1] - this->_start[c] > 1) {
+            this->_slot[c] = blocks++;
+            status = this->factorise_block(network, c);
+        }
+    }
+    return status;
+}
+
+/*
+ * Solves for columns 'first' to 'first + num' of 'flow' using the factors of
+ * the last call to 'factorise'.
+ */
+int
+rfn::ComponentSolver::solve_columns(rfn::Matrix* const flow,
+    const unsigned first, const unsigned num)
+{
+    gsl_matrix_view columns = gsl_matrix_submatrix(flow, 0, first,
+        flow->size1, num);
+    return this->propagate(&columns.matrix);
+}
+
+
+/*******************************************************************************
+ * Internal Functions
+ ******************************************************************************/
+
+
+/*
+ * Iterative version of Tarjan's algorithm, roots and targets are visited in
+ * ascending order. A node that has been visited but not yet assigned to a
+ * component is on the stack.
+ */
+unsigned
+rfn::ComponentSolver::strong_components(rfn::Adjacency const* const network)
+{
+    const unsigned n = network->num_vertices();
+    this->_component.assign(n, n);
+    this->_order.assign(n, n);
+    this->_low.resize(n);
+    this->_next.resize(n);
+    this->_path.clear();
+    this->_stack.clear();
+    const unsigned words = network->words();
+    rfn::Adjacency::Word const* row = NULL;
+    unsigned time = 0u;
+    unsigned num = 0u;
+    unsigned v = 0u;
+    unsigned w = 0u;
+    for (unsigned s = 0; s < n; ++s) {
+        if (this->_order[s] < n) {
+            continue;
+        }
+        this->_order[s] = this->_low[s] = time++;
+        this->_next[s] = 0u;
+        this->_path.push_back(s);
+        this->_stack.push_back(s);
+        while (!this->_path.empty()) {
+            v = this->_path.back();
+            // continue with the next undiscovered target of 'v'
+            row = network->out_row(v);
+            for (w = rfn::Adjacency::next(row, words, this->_next[v]); w < n;
+                w = rfn::Adjacency::next(row, words, w + 1))
+            {
+                if (this->_order[w] == n) {
+                    break;
+                }
+                if (this->_component[w] == n) {
+                    this->_low[v] = std::min(this->_low[v], this->_order[w]);
+                }
+            }
+            if (w < n) {
+                this->_next[v] = w + 1;
+                this->_order[w] = this->_low[w] = time++;
+                this->_next[w] = 0u;
+                this->_path.push_back(w);
+                this->_stack.push_back(w);
+                continue;
+            }
+            this->_path.pop_back();
+            if (this->_low[v] == this->_order[v]) {
+                // 'v' is the root of a component
+                do {
+                    w = this->_stack.back();
+                    this->_stack.pop_back();
+                    this->_component[w] = num;
+                } while (w != v);
+                ++num;
+            }
+            if (!this->_path.empty()) {
+                w = this->_path.back();
+                this->_low[w] = std::min(this->_low[w], this->_low[v]);
+            }
+        }
+    }
+    return num;
+}
+
+/*
+ * Every cyclic block fits into buffers for all nodes of the network.
+ */
+void
+rfn::ComponentSolver::reserve(const unsigned cols)
+{
+    const unsigned n = this->_parameters->nodes_total();
+    if (this->_rhs == NULL || this->_rhs->size2 < cols) {
+        if (this->_rhs != NULL) {
+            gsl_matrix_free(this->_rhs);
+        }
+        this->_rhs = gsl_matrix_alloc(n, cols);
+        CHECK_CRITICAL_GSL_POINTER(this->_rhs, __FILE__, __LINE__);
+    }
+    if (this->_parameters->solver_type() != rfn::sparse_lu
+        && this->_block == NULL)
+    {
+        this->_block = gsl_matrix_alloc(n, n);
+        CHECK_CRITICAL_GSL_POINTER(this->_block, __FILE__, __LINE__);
+        this->_permutation = gsl_permutation_alloc(n);
+        CHECK_CRITICAL_GSL_POINTER(this->_permutation, __FILE__, __LINE__);
+    }
+}
+
+/*
+ * Pass the flow through the components in topological order.
+ */
+int
+rfn::ComponentSolver::propagate(rfn::Matrix* const flow)
+{
+    rfn::Profile::Scope scope(rfn::Profile::solve);
+    const unsigned cols = (unsigned)flow->size2;
+    // rows are addressed directly, this loop runs once per right hand side
+    // when they are solved one at a time
+    double* const data = flow->data;
+    const size_t tda = flow->tda;
+    double weight = 0.0;
+    double* source = NULL;
+    double* target = NULL;
+    unsigned j = 0u;
+    int status = 0;
+    for (unsigned c = this->_num; c-- > 0;) {
+        if (this->_start[c + 1] - this->_start[c] > 1) {
+            // inflow is complete, solve the cyclic block for its nodes
+            status = this->solve_block(flow, c);
+            if (status != 0) {
+                break;
+            }
+        }
+        // pass the flow of the component on to its downstream nodes
+        for (unsigned p = this->_start[c]; p < this->_start[c + 1]; ++p) {
+            weight = this->_weight[p];
+            source = data + this->_nodes[p] * tda;
+            for (unsigned e = this->_first[p]; e < this->_first[p + 1]; ++e) {
+                target = data + this->_targets[e] * tda;
+                for (j = 0; j < cols; ++j) {
+                    target[j] += weight * source[j];
+                }
+            }
+        }
+    }
+    return status;
+}
+
+/*
+ * Factorise the SLE of the cyclic component 'c'. Blocks occupy disjoint
+ * diagonal blocks of '_block' at the position of their nodes, thus the factors
+ * of all of them are available at once.
+ */
+int
+rfn::ComponentSolver::factorise_block(rfn::Adjacency const* const network,
+    const unsigned c)
+{
+    rfn::Adjacency::Iterator oeit, oeit_end;
+    unsigned const* const nodes = &this->_nodes[this->_start[c]];
+    const unsigned size = this->_start[c + 1] - this->_start[c];
+    // all columns of a component without exit sum to zero, i.e., the flow is
+    // trapped and the SLE is singular
+    bool exit = false;
+    for (unsigned a = 0; a < size && !exit; ++a) {
+        for (boost::tie(oeit, oeit_end) = network->out_neighbours(nodes[a]);
+            oeit != oeit_end; ++oeit)
+        {
+            if (this->_component[*oeit] != c) {
+                exit = true;
+                break;
+            }
+        }
+    }
+    if (!exit) {
+        return GSL_ESING;
+    }
+    if (this->_parameters->solver_type() == rfn::sparse_lu) {
+        const unsigned slot = this->_slot[c];
+        if (this->_sparse.size() <= slot) {
+            this->_sparse.resize(slot + 1);
+        }
+        this->_sparse[slot].assemble(network, nodes, size);
+        rfn::Profile::Scope scope(rfn::Profile::factorise);
+        return this->_sparse[slot].decompose();
+    }
+    this->reserve(1u);
+    const unsigned first = this->_start[c];
+    gsl_matrix_view sle = gsl_matrix_submatrix(this->_block, first, first,
+        size, size);
+    gsl_permutation p;
+    p.size = size;
+    p.data = this->_permutation->data + first;
+    // local numbering of the component's nodes
+    this->_local.assign(this->_component.size(), size);
+    for (unsigned a = 0; a < size; ++a) {
+        this->_local[nodes[a]] = a;
+    }
+    rfn::LinearAlgebra const* const backend = rfn::LinearAlgebra::backend(
+        this->_parameters->backend());
+    backend->assemble(network, nodes, size, this->_local, &sle.matrix);
+    rfn::Profile::Scope scope(rfn::Profile::factorise);
+    return backend->factorise(&sle.matrix, &p);
+}
+
+/*
+ * Solve the factorised SLE of the cyclic component 'c', the rows of 'flow'
+ * belonging to its nodes hold the inflow from upstream components on entry
+ * and the solution on return.
+ */
+int
+rfn::ComponentSolver::solve_block(rfn::Matrix* const flow, const unsigned c)
+{
+    unsigned const* const nodes = &this->_nodes[this->_start[c]];
+    const unsigned size = this->_start[c + 1] - this->_start[c];
+    const unsigned cols = (unsigned)flow->size2;
+    int status = 0;
+    this->reserve(cols);
+    gsl_matrix_view rhs = gsl_matrix_submatrix(this->_rhs, 0, 0, size, cols);
+    unsigned a = 0u;
+    unsigned j = 0u;
+    if (this->_parameters->solver_type() == rfn::sparse_lu) {
+        for (a = 0; a < size; ++a) {
+            std::copy(flow->data + nodes[a] * flow->tda, flow->data +
+                nodes[a] * flow->tda + cols, rhs.matrix.data + a *
+                rhs.matrix.tda);
+        }
+        rfn::SparseLU& sparse = this->_sparse[this->_slot[c]];
+        for (j = 0; j < cols && status == 0; ++j) {
+            gsl_vector_view x = gsl_matrix_column(&rhs.matrix, j);
+            status = sparse.solve(&x.vector);
+        }
+    }
+    else {
+        const unsigned first = this->_start[c];
+        gsl_matrix_const_view sle = gsl_matrix_const_submatrix(this->_block,
+            first, first, size, size);
+        // gather the right hand sides in pivot order
+        size_t const* const p = this->_permutation->data + first;
+        for (a = 0; a < size; ++a) {
+            std::copy(flow->data + nodes[p[a]] * flow->tda, flow->data +
+                nodes[p[a]] * flow->tda + cols, rhs.matrix.data + a *
+                rhs.matrix.tda);
+        }
+        status = rfn::LinearAlgebra::backend(this->_parameters->backend())->
+            solve(&sle.matrix, &rhs.matrix);
+    }
+    if (status == 0) {
+        for (a = 0; a < size; ++a) {
+            std::copy(rhs.matrix.data + a * rhs.matrix.tda, rhs.matrix.data +
+                a * rhs.matrix.tda + cols, flow->data + nodes[a] * flow->tda);
+        }
+    }
+    return status;
+}
+
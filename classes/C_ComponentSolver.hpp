@@ -0,0 +1,113 @@
+/*******************************************************************************
+ * filename:    C_ComponentSolver.hpp
+ * description: Solves the flow distribution SLE along strongly connected
+ *              components
+ * author:      agent
+ * created:     2026-10-17
+ * copyright:   Jacobs University Bremen. All rights reserved.
+ *******************************************************************************
+ * The SLE is block triangular with respect to the strongly connected components
+ * of the network. Flow is thus propagated through the components in
+ * topological order and only cyclic components require a factorisation. For an
+ * acyclic network this is a single pass over all edges per right hand side.
+ *
+ * All buffers are kept between calls and only grow, thus repeated solves of
+ * networks of the same size do not allocate.
+ ******************************************************************************/
+
+
+#ifndef _C_COMPONENTSOLVER_HPP
+#define	_C_COMPONENTSOLVER_HPP
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+
+// std
+#include <vector>
+
+// gsl
+#include <gsl/gsl_permutation.h>
+
+// project
+#include "common_definitions.hpp"
+#include "C_ParameterManager.hpp"
+#include "C_SparseLU.hpp"
+
+
+/*******************************************************************************
+ * Declarations
+ ******************************************************************************/
+
+
+namespace rfn {
+
+    class ComponentSolver {
+
+    protected:
+        /* Data Members */
+        ParameterManager* _parameters;
+        // workspace
+        std::vector<unsigned> _component;
+        std::vector<unsigned> _start;
+        std::vector<unsigned> _nodes;
+        std::vector<unsigned> _pos;
+        // Tarjan's algorithm
+        std::vector<unsigned> _order;
+        std::vector<unsigned> _low;
+        std::vector<unsigned> _next;
+        std::vector<unsigned> _path;
+        std::vector<unsigned> _stack;
+        // number of components, links leaving the component of their source
+        // by position in '_nodes' and the weight of the links of each node
+        unsigned _num;
+        std::vector<unsigned> _first;
+        std::vector<unsigned> _targets;
+        std::vector<double> _weight;
+        // cyclic blocks, the dense factors of all blocks share '_block', the
+        // sparse ones are stored in '_sparse' at the '_slot' of the component
+        std::vector<unsigned> _local;
+        std::vector<unsigned> _slot;
+        Matrix* _block;
+        Matrix* _rhs;
+        gsl_permutation* _permutation;
+        std::vector<SparseLU> _sparse;
+
+    public:
+        /* Constructors & Destructor */
+        ComponentSolver(ParameterManager* const parameters);
+        virtual ~ComponentSolver();
+
+        /* Member Functions */
+        // 'flow' holds the injection at each node (rows) per right hand side
+        // (columns) on entry and the flow through each node on return, returns
+        // a gsl status
+        int solve(Adjacency const* const network, Matrix* const flow);
+        // prepare the solution of right hand sides in portions, returns a
+        // gsl status
+        int factorise(Adjacency const* const network);
+        // solve 'num' columns of 'flow' from column 'first' on for the
+        // network of the last 'factorise'
+        int solve_columns(Matrix* const flow, const unsigned first,
+            const unsigned num);
+
+    protected:
+        /* Internal Functions */
+        // number the strongly connected components in reverse topological
+        // order, returns their number
+        unsigned strong_components(Adjacency const* const network);
+        // allocate the buffers of cyclic blocks with 'cols' right hand sides
+        void reserve(const unsigned cols);
+        int propagate(Matrix* const flow);
+        int factorise_block(Adjacency const* const network, const unsigned c);
+        int solve_block(Matrix* const flow, const unsigned c);
+
+    }; // class ComponentSolver
+
+} // namespace rfn
+
+
+#endif	// _C_COMPONENTSOLVER_HPP
+
@@ -0,0 +1,175 @@
+/*******************************************************************************
+ * filename:    C_DenseLinearAlgebra.cpp
+ * description: Implementation of 'DenseLinearAlgebra' class
+ * author:      agent
+ * created:     2026-10-17
+ * copyright:   Jacobs University Bremen. All rights reserved.
+ ******************************************************************************/
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+
+// std
+#include <cmath>
+#include <algorithm>
+
+// gsl
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_permutation.h>
+
+// project
+#include "C_DenseLinearAlgebra.hpp"
+#include "C_PatternKernels.hpp"
+
+
+/*******************************************************************************
+ * Constructors & Destructor
+ ******************************************************************************/
+
+
+/*
+ * Default constructor
+ */
+rfn::DenseLinearAlgebra::DenseLinearAlgebra():
+    rfn::LinearAlgebra()
+{}
+
+/*
+ * Destructor
+ */
+rfn::DenseLinearAlgebra::~DenseLinearAlgebra()
+{}
+
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+
+
+/*
+ * Right-looking elimination, the first element of largest magnitude in a
+ * column becomes its pivot.
+ */
+int
+rfn::DenseLinearAlgebra::factorise(rfn::Matrix* const sle,
+    gsl_permutation* const p) const
+{
+    const size_t size = sle->size1;
+    if (sle->size2 != size || p->size != size) {
+        return GSL_EBADLEN;
+    }
+    gsl_permutation_init(p);
+    double* const data = sle->data;
+    const size_t tda = sle->tda;
+    double* pivot = NULL;
+    double* row = NULL;
+    double largest = 0.0;
+    double value = 0.0;
+    double factor = 0.0;
+    size_t best = 0;
+    size_t i = 0;
+    size_t k = 0;
+    for (size_t j = 0; j + 1 < size; ++j) {
+        largest = 0.0;
+        best = j;
+        for (i = j; i < size; ++i) {
+            value = std::fabs(data[i * tda + j]);
+            if (value > largest) {
+                largest = value;
+                best = i;
+            }
+        }
+        pivot = data + j * tda;
+        if (best != j) {
+            std::swap_ranges(pivot, pivot + size, data + best * tda);
+            std::swap(p->data[j], p->data[best]);
+        }
+        if (pivot[j] == 0.0) {
+            continue;
+        }
+        for (i = j + 1; i < size; ++i) {
+            row = data + i * tda;
+            if (row[j] == 0.0) {
+                continue;
+            }
+            factor = row[j] / pivot[j];
+            row[j] = factor;
+            for (k = j + 1; k < size; ++k) {
+                row[k] -= factor * pivot[k];
+            }
+        }
+    }
+    return GSL_SUCCESS;
+}
+
+/*
+ * Forward and backward substitution on whole rows of 'rhs'.
+ */
+int
+rfn::DenseLinearAlgebra::solve(const rfn::Matrix* const lu,
+    rfn::Matrix* const rhs) const
+{
+    int status = rfn::LinearAlgebra::check_singular(lu);
+    if (status != 0) {
+        return status;
+    }
+    const size_t size = lu->size1;
+    const size_t cols = rhs->size2;
+    double factor = 0.0;
+    double* row = NULL;
+    const double* pivot = NULL;
+    size_t i = 0;
+    size_t k = 0;
+    size_t j = 0;
+    // unit lower triangle
+    for (i = 1; i < size; ++i) {
+        row = rhs->data + i * rhs->tda;
+        for (k = 0; k < i; ++k) {
+            factor = lu->data[i * lu->tda + k];
+            if (factor == 0.0) {
+                continue;
+            }
+            pivot = rhs->data + k * rhs->tda;
+            for (j = 0; j < cols; ++j) {
+                row[j] -= factor * pivot[j];
+            }
+        }
+    }
+    // upper triangle
+    for (i = size; i-- > 0;) {
+        row = rhs->data + i * rhs->tda;
+        for (k = i + 1; k < size; ++k) {
+            factor = lu->data[i * lu->tda + k];
+            if (factor == 0.0) {
+                continue;
+            }
+            pivot = rhs->data + k * rhs->tda;
+            for (j = 0; j < cols; ++j) {
+                row[j] -= factor * pivot[j];
+            }
+        }
+        factor = lu->data[i * lu->tda + i];
+        for (j = 0; j < cols; ++j) {
+            row[j] /= factor;
+        }
+    }
+    return GSL_SUCCESS;
+}
+
+double
+rfn::DenseLinearAlgebra::squared_error(const rfn::Matrix* const a,
+    const rfn::Matrix* const b) const
+{
+    return rfn::PatternKernels::squared_error(a, b);
+}
+
+double
+rfn::DenseLinearAlgebra::complexity(const rfn::Matrix* const pattern) const
+{
+    return rfn::PatternKernels::complexity(pattern);
+}
+
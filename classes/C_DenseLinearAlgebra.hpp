@@ -0,0 +1,61 @@
+/*******************************************************************************
+ * filename:    C_DenseLinearAlgebra.hpp
+ * description: In-house dense linear algebra backend
+ * author:      agent
+ * created:     2026-10-17
+ * copyright:   Jacobs University Bremen. All rights reserved.
+ *******************************************************************************
+ * Factorisation and substitution work on whole rows so that the innermost loops
+ * run over contiguous memory, and skip the zero multipliers that dominate the
+ * SLE of a sparse network. Elements that are updated go through the same
+ * operations in the same order as with 'gsl_linalg_LU_decomp' and
+ * 'gsl_linalg_LU_svx'. Patterns are compared by the vectorised
+ * 'PatternKernels'.
+ ******************************************************************************/
+
+
+#ifndef _C_DENSELINEARALGEBRA_HPP
+#define	_C_DENSELINEARALGEBRA_HPP
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+
+// project
+#include "C_LinearAlgebra.hpp"
+
+
+/*******************************************************************************
+ * Declarations
+ ******************************************************************************/
+
+
+namespace rfn {
+
+    class DenseLinearAlgebra: public LinearAlgebra {
+
+    public:
+        /* Constructors & Destructor */
+        DenseLinearAlgebra();
+        virtual ~DenseLinearAlgebra();
+
+        /* Member Functions */
+        virtual const char* name() const
+        {
+            return "dense";
+        }
+        virtual int factorise(Matrix* const sle, gsl_permutation* const p)
+            const;
+        virtual int solve(const Matrix* const lu, Matrix* const rhs) const;
+        virtual double squared_error(const Matrix* const a,
+            const Matrix* const b) const;
+        virtual double complexity(const Matrix* const pattern) const;
+
+    }; // class DenseLinearAlgebra
+
+} // namespace rfn
+
+
+#endif	// _C_DENSELINEARALGEBRA_HPP
@@ -74,7 +74,7 @@ rfn::EdgeListNetworkInitialiser::init(rfn::ParameterManager* const parameters,
             catch (boost::bad_lexical_cast& err) {
                 std::cerr << err.what() << std::endl;
             }
-            boost::add_edge(src, tar, *network);
+            network->add_edge(src, tar);
         }
         else {
             throw "Bad line format!";
@@ -16,14 +16,19 @@
 
 // std
 #include <iostream>
+#include <vector>
+#include <algorithm>
 
 // gsl
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_sf_exp.h>
+#include <gsl/gsl_sf_log.h>
 
 // project
 #include "C_Evolution.hpp"
 #include "C_RobustEvolution.hpp"
+#include "C_TemperingEvolution.hpp"
+#include "C_Profile.hpp"
 
 
 /*******************************************************************************
@@ -46,7 +51,16 @@ rfn::Evolution::Evolution():
     _current_time(0L),
     _val_dist(NULL),
     _val_gen(NULL),
-    _parameters(rfn::ParameterManager::instance())
+    _parameters(rfn::ParameterManager::instance()),
+    _telemetry(NULL),
+    _archive(NULL),
+    _writer(NULL),
+    _checkpointed(0L),
+    _recorded(0L),
+    _attempted(0L),
+    _accepted(0L),
+    _clock(0.0),
+    _pool(NULL)
 {
     // tie rng to get a number between 0 and 1
     this->_val_dist = new Real;
@@ -60,11 +74,16 @@ rfn::Evolution::Evolution():
  */
 rfn::Evolution::~Evolution()
 {
+    delete this->_pool;
+    this->_pool = NULL;
     delete this->_val_gen;
     this->_val_gen = NULL;
     delete this->_val_dist;
     this->_val_dist = NULL;
     this->_parameters = NULL; // singleton destroys itself
+    this->_telemetry = NULL;
+    this->_archive = NULL;
+    this->_writer = NULL;
 }
 
 
@@ -95,7 +114,12 @@ rfn::Evolution::instance(const rfn::FunctionalNetworkScheme scheme)
         static rfn::Evolution::Guard g;
         switch (scheme) {
             case rfn::flow_evolved:
-                rfn::Evolution::_instance = new rfn::Evolution;
+                if (rfn::ParameterManager::instance()->temperatures() > 1) {
+                    rfn::Evolution::_instance = new rfn::TemperingEvolution;
+                }
+                else {
+                    rfn::Evolution::_instance = new rfn::Evolution;
+                }
                 break;
             default:
                 rfn::Evolution::_instance = new rfn::RobustEvolution;
@@ -125,6 +149,7 @@ rfn::Evolution::run(rfn::FlowDistributionNetwork* const f_net)
 #ifdef VERBOSE
     cout << endl;
 #endif
+    this->start_progress();
     // use the actual _current_time for the evolution
     for (; this->_current_time <= this->_parameters->max_time();
         ++this->_current_time)
@@ -135,13 +160,18 @@ rfn::Evolution::run(rfn::FlowDistributionNetwork* const f_net)
                 " flow error: " << f_net->flow_error() << endl;
         }
 #endif
+        this->checkpoint(f_net);
         if (store) {
             if (this->_current_time % when == 0) {
-                f_net->save(this->_current_time);
+                this->snapshot(f_net, this->_current_time);
             }
         }
         // proceed in evolution
-        this->step(f_net);
+        ++this->_attempted;
+        if (this->step(f_net)) {
+            ++this->_accepted;
+        }
+        this->progress(f_net, -1.0, false);
         // check for abortion criteria
         if (gsl_fcmp(f_net->flow_error(), this->_parameters->error_threshold(),
             GSL_EPSILON) < 0)
@@ -150,6 +180,49 @@ rfn::Evolution::run(rfn::FlowDistributionNetwork* const f_net)
             break;
         }
     }
+    this->finish(f_net);
+    this->progress(f_net, -1.0, true);
+}
+
+/*
+ * The latest checkpoint is preferred, the previous one is used if the latest
+ * cannot be read, e.g., because the node failed while it was being written.
+ */
+bool
+rfn::Evolution::resume(rfn::FlowDistributionNetwork* const f_net)
+{
+    using std::cerr;
+    using std::endl;
+    const std::string path = this->checkpoint_path(f_net);
+    const std::string previous = rfn::SnapshotWriter::previous(path);
+    if (!bfsys::exists(path) && !bfsys::exists(previous)) {
+        if (this->_archive != NULL) {
+            return !this->_archive->contains(f_net->name(),
+                rfn::Archive::final_record);
+        }
+        return !bfsys::exists(f_net->name() + "_final.dat");
+    }
+    if (bfsys::exists(path) && this->restore(path, f_net)) {
+        return true;
+    }
+    if (bfsys::exists(previous) && this->restore(previous, f_net)) {
+        cerr << "Warning: Network '" << f_net->name() << "' resumes from"
+            " its previous checkpoint." << endl;
+        return true;
+    }
+    cerr << "Network '" << f_net->name() << "' has no usable checkpoint."
+        " Aborting." << endl;
+    std::exit(EXIT_FAILURE);
+}
+
+/*
+ * Prune the evolved network and write its final state
+ */
+void
+rfn::Evolution::finish(rfn::FlowDistributionNetwork* const f_net)
+{
+    using std::cout;
+    using std::endl;
 #ifdef VERBOSE
     cout << "\033[0F\033[2Ktime: " << this->_current_time <<
                 " flow error: " << f_net->flow_error() << endl;
@@ -160,37 +233,358 @@ rfn::Evolution::run(rfn::FlowDistributionNetwork* const f_net)
                 " flow error: " << f_net->flow_error() << endl;
     cout << endl;
 #endif
-    if (store) {
-        f_net->store();
+    this->write_state(f_net, rfn::Archive::final_record, "final",
+        (this->_current_time <= this->_parameters->max_time()) ?
+        this->_current_time : this->_parameters->max_time());
+    this->submit(rfn::SnapshotWriter::remove_file, this->checkpoint_path(f_net),
+        "");
+}
+
+/*
+ * The state is serialised right away and written by '_writer' if there is one,
+ * thus 'f_net' may change as soon as this returns.
+ */
+void
+rfn::Evolution::write_state(rfn::FlowDistributionNetwork* const f_net,
+    const rfn::Archive::Kind kind, const std::string& suffix,
+    const unsigned long time)
+{
+    if (this->_archive != NULL) {
+        rfn::Archive::Record record;
+        f_net->archive_record(*this->_archive, kind, time, record);
+        if (this->_writer != NULL) {
+            this->_writer->push(*this->_archive, record);
+        }
+        else {
+            this->_archive->append(record);
+        }
+        return;
     }
     std::stringstream filename;
-    filename << f_net->name() << "_final.dat";
-    bfsys::ofstream output(filename.str(), std::ios::binary);
-    f_net->write_to_binary_stream(output, (this->_current_time <=
-        this->_parameters->max_time()) ? this->_current_time :
-        this->_parameters->max_time());
-    output.close();
+    filename << f_net->name() << "_" << suffix << ".dat";
+    std::ostringstream bytes;
+    rfn::BinaryWriter writer(bytes, rfn::BinaryWriter::STATE_MAGIC);
+    f_net->write_to_binary_stream(writer, time);
+    writer.finish();
+    this->submit(rfn::SnapshotWriter::write_file, filename.str(), bytes.str());
+}
+
+void
+rfn::Evolution::snapshot(rfn::FlowDistributionNetwork* const f_net,
+    const unsigned long time)
+{
+    std::stringstream suffix;
+    suffix << time;
+    this->write_state(f_net, rfn::Archive::snapshot_record, suffix.str(),
+        time);
+}
+
+void
+rfn::Evolution::submit(const rfn::SnapshotWriter::Action action,
+    const std::string& path, const std::string& data)
+{
+    if (this->_writer != NULL) {
+        this->_writer->push(action, path, data);
+    }
+    else {
+        rfn::SnapshotWriter::apply(action, path, data);
+    }
 }
 
 /*
- * One evolutionary step
+ * A checkpoint holds the parameters, the time, the state of the random number
+ * generator and what 'write_checkpoint' adds. Writing it neither changes the
+ * networks nor draws random numbers, thus an evolution continues the same
+ * with or without checkpoints.
  */
 void
+rfn::Evolution::checkpoint(rfn::FlowDistributionNetwork* const f_net)
+{
+    if (this->_parameters->checkpoint_interval() == 0 || this->_current_time <
+        this->_checkpointed + this->_parameters->checkpoint_interval())
+    {
+        return;
+    }
+    std::ostringstream bytes;
+    rfn::BinaryWriter writer(bytes, rfn::BinaryFormat::CHECKPOINT_MAGIC);
+    writer.put_string(this->encode_parameters());
+    writer.put_u64(this->_current_time);
+    std::ostringstream generator;
+    generator << this->_parameters->rng();
+    writer.put_string(generator.str());
+    this->write_checkpoint(writer, f_net);
+    writer.finish();
+    this->submit(rfn::SnapshotWriter::replace_file,
+        this->checkpoint_path(f_net), bytes.str());
+    this->_checkpointed = this->_current_time;
+}
+
+void
+rfn::Evolution::write_checkpoint(rfn::BinaryWriter& out,
+    rfn::FlowDistributionNetwork* const f_net)
+{
+    f_net->write_checkpoint(out, this->_current_time);
+}
+
+void
+rfn::Evolution::read_checkpoint(rfn::BinaryReader& in,
+    rfn::FlowDistributionNetwork* const f_net)
+{
+    f_net->read_checkpoint(in);
+}
+
+std::string
+rfn::Evolution::checkpoint_path(rfn::FlowDistributionNetwork* const f_net)
+    const
+{
+    return f_net->name() + ".checkpoint";
+}
+
+/*
+ * A checkpoint is read in full and checked before anything is restored. The
+ * generator is restored last as reading networks seeds it.
+ */
+bool
+rfn::Evolution::restore(const std::string& path,
+    rfn::FlowDistributionNetwork* const f_net)
+{
+    using std::cerr;
+    using std::endl;
+    bfsys::ifstream input(path, std::ios::binary);
+    std::stringstream bytes;
+    bytes << input.rdbuf();
+    input.close();
+    if (!rfn::BinaryFormat::intact(bytes.str(),
+        rfn::BinaryFormat::CHECKPOINT_MAGIC))
+    {
+        cerr << "Warning: '" << path << "' is no complete checkpoint." << endl;
+        return false;
+    }
+    rfn::BinaryReader reader(bytes, rfn::BinaryFormat::CHECKPOINT_MAGIC);
+    if (reader.version() > rfn::BinaryFormat::VERSION) {
+        cerr << "Warning: '" << path << "' was written by a newer version."
+            << endl;
+        return false;
+    }
+    if (reader.get_string() != this->encode_parameters()) {
+        cerr << "Warning: '" << path << "' was written with other"
+            " parameters." << endl;
+        return false;
+    }
+    this->_current_time = reader.get_u64();
+    std::stringstream generator(reader.get_string());
+    this->read_checkpoint(reader, f_net);
+    generator >> this->_parameters->rng();
+    if (!generator || !reader.at_end() || !reader.finish()) {
+        cerr << "Warning: '" << path << "' does not match this evolution."
+            << endl;
+        return false;
+    }
+    this->_checkpointed = this->_current_time;
+    return true;
+}
+
+std::string
+rfn::Evolution::encode_parameters()
+{
+    std::ostringstream bytes;
+    rfn::BinaryWriter writer(bytes, rfn::BinaryFormat::PARAMETERS_MAGIC);
+    this->_parameters->write_to_binary_stream(writer);
+    writer.finish();
+    return bytes.str();
+}
+
+/*
+ * One evolutionary step
+ */
+bool
 rfn::Evolution::step(rfn::FlowDistributionNetwork* const f_net)
+{
+    if (this->_parameters->candidates() > 1) {
+        return this->population_step(f_net);
+    }
+    return this->step(f_net, this->_parameters->annealing_factor(),
+        *this->_val_gen);
+}
+
+/*
+ * One evolutionary step that draws from 'uniform' rather than the generator of
+ * this instance, thus it may be called concurrently on different networks.
+ */
+bool
+rfn::Evolution::step(rfn::FlowDistributionNetwork* const f_net,
+    const double factor, Real_Number& uniform)
 {
     // calculate flow error
-    rfn::FlowDistributionNetwork next(*f_net);
-    next.mutate();
-    if (gsl_fcmp(next.flow_error(), f_net->flow_error(), GSL_EPSILON) < 0) {
+    rfn::FlowDistributionNetwork* next = f_net->candidate();
+    {
+        rfn::Profile::Scope scope(rfn::Profile::mutate);
+        next->mutate();
+    }
+    const bool accepted = this->accept(f_net, next, factor, uniform);
+    if (accepted) {
+        f_net->exchange(*next);
+    }
+    rfn::Profile::step(accepted);
+    return accepted;
+}
+
+/*
+ * Acceptance criterion of a mutated network. A uniform variate 'u' accepts it
+ * below e (1 - factor ln u) where 'e' is the current flow error, which bounds
+ * the evaluation of 'next' with 'early_exit()'. The variate is only drawn if
+ * 'next' is not better, thus the random numbers consumed do not change.
+ */
+bool
+rfn::Evolution::accept(rfn::FlowDistributionNetwork* const f_net,
+    rfn::FlowDistributionNetwork* const next, const double factor,
+    Real_Number& uniform)
+{
+    const double current = f_net->flow_error();
+    if (gsl_fcmp(next->flow_error(current), current, GSL_EPSILON) < 0) {
         // flow error is smaller than old one
-        *f_net = next;
+        return true;
+    }
+    // small probability of accepting change anyway to avoid local minima
+    const double u = uniform();
+    double error = 0.0;
+    if (u > 0.0 && current > 0.0) {
+        const double ceiling = current * (1.0 - factor * gsl_sf_log(u));
+        error = next->flow_error(ceiling);
+        if (gsl_fcmp(error, ceiling, GSL_SQRT_DBL_EPSILON) > 0) {
+            // evaluation stopped early
+            return false;
+        }
     }
     else {
-        // small probability of accepting change anyway to avoid local minima
-        if (gsl_fcmp((*this->_val_gen)(), gsl_sf_exp((f_net->flow_error() -
-            next.flow_error()) / (this->_parameters->annealing_factor() *
-            f_net->flow_error())), GSL_EPSILON) < 0) {
-            *f_net = next;
+        error = next->flow_error();
+    }
+    return gsl_fcmp(u, gsl_sf_exp((current - error) / (factor * current)),
+        GSL_EPSILON) < 0;
+}
+
+/*
+ * One evolutionary step with 'candidates()' mutated networks. They are mutated
+ * in order in this thread and evaluated in parallel, so a step only depends on
+ * the seed. Either the best candidate is subject to the acceptance criterion
+ * or the first candidate that passes it is accepted. The candidates are
+ * recycled from step to step like the single one of 'step'.
+ */
+bool
+rfn::Evolution::population_step(rfn::FlowDistributionNetwork* const f_net)
+{
+    const unsigned num = this->_parameters->candidates();
+    std::vector<rfn::FlowDistributionNetwork*>& next = f_net->population(num);
+    unsigned k = 0u;
+    for (k = 0; k < num; ++k) {
+        rfn::Profile::Scope scope(rfn::Profile::mutate);
+        next[k]->mutate();
+    }
+    this->evaluate_candidates(next);
+    unsigned chosen = num;
+    if (this->_parameters->selection() == rfn::best_candidate) {
+        unsigned best = 0u;
+        for (k = 1; k < num; ++k) {
+            if (gsl_fcmp(next[k]->flow_error(), next[best]->flow_error(),
+                GSL_EPSILON) < 0)
+            {
+                best = k;
+            }
+        }
+        if (this->accept(f_net, next[best],
+            this->_parameters->annealing_factor(), *this->_val_gen))
+        {
+            chosen = best;
         }
     }
+    else {
+        for (k = 0; k < num; ++k) {
+            if (this->accept(f_net, next[k],
+                this->_parameters->annealing_factor(), *this->_val_gen))
+            {
+                chosen = k;
+                break;
+            }
+        }
+    }
+    if (chosen < num) {
+        f_net->exchange(*next[chosen]);
+    }
+    rfn::Profile::step(chosen < num);
+    return chosen < num;
+}
+
+/*
+ * Candidates are shared out among the 'candidate_threads()' shares of the
+ * pool, each evaluates every 'count'th candidate. The pool lives as long as
+ * this instance, thus a step costs two hand-overs instead of starting threads.
+ * Candidates must have been isolated.
+ */
+void
+rfn::Evolution::evaluate_candidates(
+    std::vector<rfn::FlowDistributionNetwork*>& candidates)
+{
+    if (this->_pool == NULL) {
+        this->_pool = new rfn::ThreadPool(
+            this->_parameters->candidate_threads());
+        CHECK_CRITICAL_POINTER(this->_pool);
+    }
+    Candidates job(this, candidates);
+    this->_pool->run(job);
+}
+
+void
+rfn::Evolution::Candidates::share(const unsigned index, const unsigned count)
+{
+    for (unsigned k = index; k < this->_candidates.size(); k += count) {
+        this->_evolution->evaluate(this->_candidates[k]);
+    }
+}
+
+void
+rfn::Evolution::evaluate(rfn::FlowDistributionNetwork* const f_net)
+{
+    f_net->flow_error();
+}
+
+void
+rfn::Evolution::start_progress()
+{
+    this->_recorded = this->_current_time;
+    this->_attempted = 0L;
+    this->_accepted = 0L;
+    this->_clock = rfn::Profile::wall_time();
+}
+
+/*
+ * The flow error and robustness of the current network are known after every
+ * step, thus a record costs no evaluation.
+ */
+void
+rfn::Evolution::progress(rfn::FlowDistributionNetwork* const f_net,
+    const double robustness, const bool finished)
+{
+    if (this->_telemetry == NULL || (!finished && this->_current_time <
+        this->_recorded + this->_telemetry->interval()))
+    {
+        return;
+    }
+    const double now = rfn::Profile::wall_time();
+    rfn::Telemetry::Record record;
+    record.network = f_net->name();
+    record.time = std::min(this->_current_time,
+        this->_parameters->max_time());
+    record.flow_error = f_net->flow_error();
+    record.robustness = robustness;
+    record.acceptance = (this->_attempted > 0) ? (double)this->_accepted /
+        (double)this->_attempted : 0.0;
+    record.steps_per_second = (now > this->_clock && record.time >
+        this->_recorded) ? (double)(record.time - this->_recorded) /
+        (now - this->_clock) : 0.0;
+    record.finished = finished;
+    this->_telemetry->write(record);
+    this->_recorded = record.time;
+    this->_attempted = 0L;
+    this->_accepted = 0L;
+    this->_clock = now;
 }
\ No newline at end of file
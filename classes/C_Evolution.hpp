@@ -18,6 +18,9 @@
  ******************************************************************************/
 
 
+// std
+#include <vector>
+
 // boost
 #include <boost/random/uniform_real.hpp>
 #include <boost/random/variate_generator.hpp>
@@ -26,6 +29,10 @@
 #include "M_Singleton.hpp"
 #include "C_FlowDistributionNetwork.hpp"
 #include "C_ParameterManager.hpp"
+#include "C_Telemetry.hpp"
+#include "C_SnapshotWriter.hpp"
+#include "C_Profile.hpp"
+#include "C_ThreadPool.hpp"
 //#include "C_HDF5Storage.hpp"
 
 
@@ -48,6 +55,36 @@ namespace rfn {
         Real* _val_dist;
         Real_Number* _val_gen;
         ParameterManager* _parameters;
+        Telemetry* _telemetry;
+        // NULL unless states are archived rather than written to files
+        Archive* _archive;
+        // NULL if states are written by the evolving thread
+        SnapshotWriter* _writer;
+        // time of the last checkpoint
+        unsigned long _checkpointed;
+        // progress since the last telemetry record
+        unsigned long _recorded;
+        unsigned long _attempted;
+        unsigned long _accepted;
+        double _clock;
+        // persistent threads evaluating the candidates of a step, started by
+        // the first step that needs them
+        ThreadPool* _pool;
+
+        // candidates of a step shared out among the pool
+        class Candidates: public ThreadPool::Job {
+        protected:
+            Evolution* const _evolution;
+            std::vector<FlowDistributionNetwork*>& _candidates;
+
+        public:
+            Candidates(Evolution* const evolution,
+                std::vector<FlowDistributionNetwork*>& candidates):
+                _evolution(evolution),
+                _candidates(candidates)
+            {}
+            virtual void share(const unsigned index, const unsigned count);
+        };
 
     public:
         /* Member Functions */
@@ -55,6 +92,9 @@ namespace rfn {
         static Evolution* instance(const FunctionalNetworkScheme scheme);
         // drives evolution
         virtual void run(FlowDistributionNetwork* const f_net);
+        // continue the evolution of 'f_net' from its checkpoint if there is
+        // one, false if it has already finished
+        bool resume(FlowDistributionNetwork* const f_net);
         // _current_time get method
         unsigned long current_time() const
         {
@@ -70,11 +110,75 @@ namespace rfn {
         {
             this->_parameters = p;
         }
+        // _telemetry set method
+        void telemetry(Telemetry* const t)
+        {
+            this->_telemetry = t;
+        }
+        // _archive set method
+        void archive(Archive* const a)
+        {
+            this->_archive = a;
+        }
+        // _writer set method
+        void writer(SnapshotWriter* const w)
+        {
+            this->_writer = w;
+        }
 
     protected:
         /* Internal Functions */
-        // perform one evolutionary step
-        void step(FlowDistributionNetwork* const f_net);
+        // perform one evolutionary step, returns whether 'f_net' changed
+        bool step(FlowDistributionNetwork* const f_net);
+        // prune the network and write it to disk
+        void finish(FlowDistributionNetwork* const f_net);
+        // write 'f_net' to the archive or to '<name>_<suffix>.dat'
+        void write_state(FlowDistributionNetwork* const f_net,
+            const Archive::Kind kind, const std::string& suffix,
+            const unsigned long time);
+        // write 'f_net' as the snapshot at 'time'
+        void snapshot(FlowDistributionNetwork* const f_net,
+            const unsigned long time);
+        // 'action' on the file 'path' by '_writer' if there is one
+        void submit(const SnapshotWriter::Action action,
+            const std::string& path, const std::string& data);
+        // write a checkpoint if 'checkpoint_interval()' steps have passed
+        // since the last one
+        void checkpoint(FlowDistributionNetwork* const f_net);
+        // the state of the evolution of 'f_net' beyond time, parameters and
+        // random number generator
+        virtual void write_checkpoint(BinaryWriter& out,
+            FlowDistributionNetwork* const f_net);
+        virtual void read_checkpoint(BinaryReader& in,
+            FlowDistributionNetwork* const f_net);
+        // '<name>.checkpoint'
+        std::string checkpoint_path(FlowDistributionNetwork* const f_net)
+            const;
+        // continue from the checkpoint in 'path', false if it is unusable
+        bool restore(const std::string& path,
+            FlowDistributionNetwork* const f_net);
+        // '_parameters' as written to 'parameters.dat'
+        std::string encode_parameters();
+        // perform one evolutionary step at the given annealing factor
+        bool step(FlowDistributionNetwork* const f_net, const double factor,
+            Real_Number& uniform);
+        // whether to replace 'f_net' by the mutated network 'next'
+        bool accept(FlowDistributionNetwork* const f_net,
+            FlowDistributionNetwork* const next, const double factor,
+            Real_Number& uniform);
+        // perform one evolutionary step with several mutated networks
+        bool population_step(FlowDistributionNetwork* const f_net);
+        // evaluate several networks in parallel
+        void evaluate_candidates(
+            std::vector<FlowDistributionNetwork*>& candidates);
+        // compute all that acceptance of a candidate requires
+        virtual void evaluate(FlowDistributionNetwork* const f_net);
+        // start counting progress for telemetry records
+        void start_progress();
+        // telemetry record of 'f_net' every 'interval()' steps and once
+        // 'finished', a negative 'robustness' is omitted
+        void progress(FlowDistributionNetwork* const f_net,
+            const double robustness, const bool finished);
 
     };
 
@@ -18,22 +18,18 @@
 // std
 #include <cstdlib>
 #include <iostream>
+#include <algorithm>
 
 // gsl
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_vector.h>
 #include <gsl/gsl_matrix.h>
-#include <gsl/gsl_linalg.h>
 #include <gsl/gsl_permutation.h>
-#include <gsl/gsl_blas.h>
-
-// boost
-#include <boost/graph/breadth_first_search.hpp>
-#include <boost/graph/adjacency_matrix.hpp>
-#include <boost/pending/queue.hpp>
 
 // project
 #include "C_FlowDistributionNetwork.hpp"
+#include "C_LinearAlgebra.hpp"
+#include "C_Profile.hpp"
 
 
 /*******************************************************************************
@@ -46,7 +42,6 @@
  */
 rfn::FlowDistributionNetwork::FlowDistributionNetwork():
     _original(true),
-    _not_assigned(false),
     _changed(true),
     _flow_error(0.0),
     _network_name(""),
@@ -57,7 +52,19 @@ rfn::FlowDistributionNetwork::FlowDistributionNetwork():
     _pattern_init(NULL),
     _mutation(NULL),
     _parameters(rfn::ParameterManager::instance()),
-    _history(NULL)
+    _solver(NULL),
+    _tracked(false),
+    _solver_state(0ul),
+    _sources(),
+    _workspace(NULL),
+    _revision(0ul),
+    _origin(NULL),
+    _origin_revision(0ul),
+    _changes(),
+    _bounded(false),
+    _bounded_revision(0ul),
+    _solved(0u),
+    _partial_error(0.0)
 {
     if (this->_parameters != NULL) {
         // network
@@ -84,8 +91,10 @@ rfn::FlowDistributionNetwork::FlowDistributionNetwork():
         this->_mutation = this->_mutation->instance(this->_parameters->
             mutation_type());
         CHECK_CRITICAL_POINTER(this->_mutation);
-        this->_history = new History();
-        CHECK_CRITICAL_POINTER(this->_history);
+        if (this->_parameters->incremental()) {
+            this->_solver = new LowRankSolver(this->_parameters);
+            CHECK_CRITICAL_POINTER(this->_solver);
+        }
     }
 }
 
@@ -95,7 +104,6 @@ rfn::FlowDistributionNetwork::FlowDistributionNetwork():
 rfn::FlowDistributionNetwork::FlowDistributionNetwork(
     const rfn::FlowDistributionNetwork& c):
     _original(false),
-    _not_assigned(true),
     _changed(c._changed),
     _flow_error(c._flow_error),
     _network_name(c._network_name),
@@ -106,7 +114,19 @@ rfn::FlowDistributionNetwork::FlowDistributionNetwork(
     _pattern_init(NULL), // no need to carry pointer, already initialised
     _mutation(c._mutation),
     _parameters(c._parameters),
-    _history(NULL) // only original accesses this
+    _solver(c._solver),
+    _tracked(c._tracked),
+    _solver_state(c._solver_state),
+    _sources(c._sources),
+    _workspace(NULL),
+    _revision(0ul),
+    _origin(NULL),
+    _origin_revision(0ul),
+    _changes(),
+    _bounded(false),
+    _bounded_revision(0ul),
+    _solved(0u),
+    _partial_error(0.0)
 {
     this->_network = new Adjacency(*c._network);
     CHECK_CRITICAL_POINTER(this->_network);
@@ -123,26 +143,17 @@ rfn::FlowDistributionNetwork::FlowDistributionNetwork(
  */
 rfn::FlowDistributionNetwork::~FlowDistributionNetwork()
 {
+    delete this->_workspace;
+    this->_workspace = NULL;
     if (this->_original) {
         // only original network should control this memory
         gsl_matrix_free(this->_ideal_pattern);
-        delete this->_network;
-        History::iterator hist_it;
-        for (hist_it = this->_history->begin();
-            hist_it != this->_history->end(); ++hist_it)
-        {
-            delete hist_it->second;
-            hist_it->second = NULL;
-        }
-        delete this->_history;
-    }
-    if (this->_not_assigned) {
-        // network was not assigned so we need to remove this memory
-        delete this->_network;
+        delete this->_solver;
     }
+    delete this->_network; // memory under own control
     this->_network = NULL;
     this->_ideal_pattern = NULL;
-    this->_history = NULL;
+    this->_solver = NULL;
     gsl_matrix_free(this->_output_pattern); // memory under own control
     this->_output_pattern = NULL;
     this->_network_init = NULL; // singleton class destructs at program exit
@@ -159,7 +170,7 @@ rfn::FlowDistributionNetwork::~FlowDistributionNetwork()
 /*
  * Virtual const assignment operator, all networks following an initial one are
  * copy-constructed during the evolution thus here we only transfer the bare
- * minimum values needed.
+ * minimum values needed. The network is copied into the memory of this one.
  */
 rfn::FlowDistributionNetwork&
 rfn::FlowDistributionNetwork::operator=(const rfn::FlowDistributionNetwork& a)
@@ -167,18 +178,14 @@ rfn::FlowDistributionNetwork::operator=(const rfn::FlowDistributionNetwork& a)
     if (this != &a) {
         // expect only networks of same type to be assigned
         assert(typeid(*this) == typeid(a));
-        // we assigned the other network in this iteration, prevent delete of
-        // a._network
-        rfn::FlowDistributionNetwork& other = const_cast
-            <rfn::FlowDistributionNetwork&>(a);
-        other._not_assigned = false;
         this->_changed = a._changed;
         this->_flow_error = a._flow_error;
-        delete this->_network;
-        this->_network = a._network;
+        *this->_network = *a._network;
+        ++this->_revision;
         int status = 0; // for gsl return status check
         status = gsl_matrix_memcpy(this->_output_pattern, a._output_pattern);
         CHECK_CRITICAL_GSL_STATUS(status, __FILE__, __LINE__);
+        this->adopt_reference(a);
     }
     return *this;
 }
@@ -186,7 +193,7 @@ rfn::FlowDistributionNetwork::operator=(const rfn::FlowDistributionNetwork& a)
 /*
  * Virtual assignment operator, all networks following an initial one are copy-
  * constructed during the evolution thus here we only transfer the bare minimum
- * values needed.
+ * values needed. The network is copied into the memory of this one.
  */
 rfn::FlowDistributionNetwork&
 rfn::FlowDistributionNetwork::operator=(rfn::FlowDistributionNetwork& a)
@@ -194,14 +201,14 @@ rfn::FlowDistributionNetwork::operator=(rfn::FlowDistributionNetwork& a)
     if (this != &a) {
         // expect only networks of same type to be assigned
         assert(typeid(*this) == typeid(a));
-        a._not_assigned = false;
         this->_changed = a._changed;
         this->_flow_error = a._flow_error;
-        delete this->_network;
-        this->_network = a._network;
+        *this->_network = *a._network;
+        ++this->_revision;
         int status = 0; // for gsl return status check
         status = gsl_matrix_memcpy(this->_output_pattern, a._output_pattern);
         CHECK_CRITICAL_GSL_STATUS(status, __FILE__, __LINE__);
+        this->adopt_reference(a);
     }
     return *this;
 }
@@ -212,120 +219,256 @@ rfn::FlowDistributionNetwork::operator=(rfn::FlowDistributionNetwork& a)
  ******************************************************************************/
 
 
+/*
+ * Same values as the copy constructor transfers but the network and output
+ * pattern are copied into the existing memory. Most mutations are rejected,
+ * thus a copy that still mirrors 'c' merely rolls back its own mutations.
+ */
 void
-rfn::FlowDistributionNetwork::save(const unsigned long time)
+rfn::FlowDistributionNetwork::copy(const rfn::FlowDistributionNetwork& c)
 {
-    History::iterator hist_it(this->_history->end());
-    // insert a copy of current state at the end (we progress in time)
-    this->_history->insert(hist_it,
-        std::pair<unsigned long, rfn::FlowDistributionNetwork*>(time, this->clone()));
+    if (this != &c) {
+        // expect only copies of networks of same type
+        assert(!this->_original && typeid(*this) == typeid(c));
+        this->_changed = c._changed;
+        this->_flow_error = c._flow_error;
+        this->_network_name = c._network_name;
+        if (this->_origin == &c && this->_origin_revision == c._revision) {
+            this->rollback();
+        }
+        else {
+            *this->_network = *c._network;
+            this->_changes.clear();
+        }
+        ++this->_revision;
+        this->_origin = &c;
+        this->_origin_revision = c._revision;
+        this->_ideal_pattern = c._ideal_pattern;
+        int status = 0; // for gsl return status check
+        status = gsl_matrix_memcpy(this->_output_pattern, c._output_pattern);
+        CHECK_CRITICAL_GSL_STATUS(status, __FILE__, __LINE__);
+        this->_mutation = c._mutation;
+        this->_parameters = c._parameters;
+        this->_solver = c._solver;
+        this->_tracked = c._tracked;
+        this->_solver_state = c._solver_state;
+        this->_sources = c._sources;
+    }
 }
 
+/*
+ * Like the assignment operator but the memory of the two networks is swapped
+ * rather than copied, 'a' remains a valid copy.
+ */
 void
-rfn::FlowDistributionNetwork::write_to_binary_stream(bfsys::ofstream& out,
+rfn::FlowDistributionNetwork::exchange(rfn::FlowDistributionNetwork& a)
+{
+    if (this != &a) {
+        // expect only networks of same type to be exchanged
+        assert(!a._original && typeid(*this) == typeid(a));
+        const bool mirror = (a._origin == this
+            && a._origin_revision == this->_revision);
+        this->_changed = a._changed;
+        this->_flow_error = a._flow_error;
+        std::swap(this->_network, a._network);
+        std::swap(this->_output_pattern, a._output_pattern);
+        ++this->_revision;
+        ++a._revision;
+        if (mirror) {
+            // 'a' received the network its mutations started from
+            a.replay();
+            a._origin_revision = this->_revision;
+        }
+        else {
+            a._origin = NULL;
+        }
+        a._changes.clear();
+        this->adopt_reference(a);
+    }
+}
+
+/*
+ * The layer sizes are only part of the portable format, they place the links
+ * and the pattern at multiples of eight bytes.
+ */
+void
+rfn::FlowDistributionNetwork::write_to_binary_stream(rfn::BinaryWriter& out,
     const unsigned long iteration)
 {
+    rfn::Profile::Scope scope(rfn::Profile::io);
     unsigned i = 0;
     unsigned j = 0;
-    out.write((char*)&iteration, sizeof(unsigned long));
-    i = this->_parameters->seed();
-    out.write((char*)&i, sizeof(unsigned));
-    double tmp = this->_parameters->connectivity();
-    out.write((char*)&tmp, sizeof(double));
-    out.write((char*)&this->_flow_error, sizeof(double));
+    out.put_u32(this->_parameters->nodes_in());
+    out.put_u32(this->_parameters->nodes_middle());
+    out.put_u32(this->_parameters->nodes_out());
+    out.put_u64(iteration);
+    out.put_u32(this->_parameters->seed());
+    out.put_f64(this->_parameters->connectivity());
+    out.put_f64(this->_flow_error);
     // saving edges
     // number of edges
-    j = (unsigned)boost::num_edges(*this->_network);
-    out.write((char*)&j, sizeof(unsigned));
-    boost::graph_traits<Adjacency>::out_edge_iterator oe_it, oe_it_end;
+    out.put_u32(this->_network->num_edges());
+    rfn::Adjacency::Iterator oe_it, oe_it_end;
     for (i = 0; i < this->_parameters->nodes_end_middle(); ++i) {
-        for (boost::tie(oe_it, oe_it_end) = boost::out_edges(i, *this->_network);
+        for (boost::tie(oe_it, oe_it_end) = this->_network->out_neighbours(i);
             oe_it != oe_it_end; ++oe_it)
         {
-            out.write((char*)&i, sizeof(unsigned));
-            j = (unsigned)boost::target(*oe_it, *this->_network);
-            out.write((char*)&j, sizeof(unsigned));
+            out.put_u32(i);
+            out.put_u32(*oe_it);
         }
     }
     // saving ideal output pattern
-    double value = 0.0;
     for (i = 0; i < this->_parameters->nodes_out(); ++i) {
         for (j = 0; j < this->_parameters->nodes_in(); ++j) {
-            value = gsl_matrix_get(this->_ideal_pattern, i, j);
-            out.write((char*)&value, sizeof(double));
+            out.put_f64(gsl_matrix_get(this->_ideal_pattern, i, j));
+        }
+    }
+}
+
+/*
+ * The flow error is stored as it is, also if it is out of date, so that it is
+ * evaluated exactly when it would have been without the checkpoint. So is the
+ * reference of the low-rank solver that this network is tracked against, as
+ * the mutated networks evaluated against it would differ in rounding from
+ * those evaluated against a new factorisation.
+ */
+void
+rfn::FlowDistributionNetwork::write_checkpoint(rfn::BinaryWriter& out,
+    const unsigned long iteration)
+{
+    this->write_to_binary_stream(out, iteration);
+    out.put_u16(this->_changed);
+    for (unsigned i = 0; i < this->_parameters->nodes_out(); ++i) {
+        for (unsigned j = 0; j < this->_parameters->nodes_in(); ++j) {
+            out.put_f64(gsl_matrix_get(this->_output_pattern, i, j));
+        }
+    }
+    const bool tracked = (this->_solver != NULL && this->_tracked
+        && this->_solver_state == this->_solver->state());
+    out.put_u16(tracked);
+    if (tracked) {
+        this->_solver->write_checkpoint(out);
+        out.put_u32((boost::uint32_t)this->_sources.size());
+        for (unsigned k = 0; k < this->_sources.size(); ++k) {
+            out.put_u32(this->_sources[k]);
+        }
+    }
+}
+
+void
+rfn::FlowDistributionNetwork::read_checkpoint(rfn::BinaryReader& in)
+{
+    for (unsigned v = 0; v < this->_network->num_vertices(); ++v) {
+        this->_network->clear_vertex(v);
+    }
+    this->read_from_binary_stream(in);
+    this->_changed = (in.get_u16() != 0u);
+    for (unsigned i = 0; i < this->_parameters->nodes_out(); ++i) {
+        for (unsigned j = 0; j < this->_parameters->nodes_in(); ++j) {
+            gsl_matrix_set(this->_output_pattern, i, j, in.get_f64());
+        }
+    }
+    if (in.get_u16() != 0u) {
+        if (this->_solver != NULL) {
+            this->_solver->read_checkpoint(in);
+            this->_tracked = true;
+            this->_solver_state = this->_solver->state();
+        }
+        else {
+            // written with incremental evaluation, which is not used now
+            LowRankSolver skipped(this->_parameters);
+            skipped.read_checkpoint(in);
+        }
+        std::vector<unsigned> sources(in.get_u32(), 0u);
+        for (unsigned k = 0; k < sources.size(); ++k) {
+            sources[k] = in.get_u32();
+        }
+        if (this->_solver != NULL) {
+            this->_sources.swap(sources);
+        }
+    }
+}
+
+void
+rfn::FlowDistributionNetwork::archive_record(rfn::Archive& archive,
+    const rfn::Archive::Kind kind, const unsigned long iteration,
+    rfn::Archive::Record& record)
+{
+    rfn::Profile::Scope scope(rfn::Profile::io);
+    record.run = this->archive_run(archive);
+    record.kind = kind;
+    record.time = iteration;
+    this->write_to_record(record);
+}
+
+void
+rfn::FlowDistributionNetwork::write_to_record(rfn::Archive::Record& record)
+{
+    const unsigned n = this->_parameters->nodes_end_middle();
+    record.flow_error = this->_flow_error;
+    record.robustness = -1.0;
+    record.degrees.resize(n);
+    record.targets.clear();
+    record.targets.reserve(this->_network->num_edges());
+    rfn::Adjacency::Iterator oe_it, oe_it_end;
+    for (unsigned i = 0; i < n; ++i) {
+        record.degrees[i] = this->_network->out_degree(i);
+        for (boost::tie(oe_it, oe_it_end) = this->_network->out_neighbours(i);
+            oe_it != oe_it_end; ++oe_it)
+        {
+            record.targets.push_back(*oe_it);
         }
     }
 }
 
 unsigned long
-rfn::FlowDistributionNetwork::read_from_binary_stream(bfsys::ifstream& in)
+rfn::FlowDistributionNetwork::read_from_binary_stream(rfn::BinaryReader& in)
 {
-    unsigned long iteration = 0L;
-    in.read((char*)&iteration, sizeof(unsigned long));
     unsigned i = 0u;
-    in.read((char*)&i, sizeof(unsigned));
-    this->_parameters->seed(i);
-    double tmp = 0.0;
-    in.read((char*)&tmp, sizeof(double));
-    this->_parameters->connectivity(tmp);
-    in.read((char*)&this->_flow_error, sizeof(double));
+    if (!in.legacy()) {
+        const unsigned nodes_in = in.get_u32();
+        const unsigned nodes_middle = in.get_u32();
+        const unsigned nodes_out = in.get_u32();
+        if (nodes_in != this->_parameters->nodes_in() || nodes_middle !=
+            this->_parameters->nodes_middle() || nodes_out !=
+            this->_parameters->nodes_out())
+        {
+            std::cerr << "Network '" << this->_network_name
+                << "' does not match the layer sizes of the stored state."
+                " Aborting." << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+    }
+    const unsigned long iteration = in.get_u64();
+    this->_parameters->seed(in.get_u32());
+    this->_parameters->connectivity(in.get_f64());
+    this->_flow_error = in.get_f64();
     // loading edges
     // number of edges
-    unsigned num_edges = 0u;
-    in.read((char*)&num_edges, sizeof(unsigned));
+    const unsigned num_edges = in.get_u32();
     unsigned u = 0u;
     unsigned v = 0u;
     for (i = 0u; i < num_edges; ++i) {
-        in.read((char*)&u, sizeof(unsigned));
-        in.read((char*)&v, sizeof(unsigned));
-        boost::add_edge(u, v, *this->_network);
+        u = in.get_u32();
+        v = in.get_u32();
+        this->_network->add_edge(u, v);
     }
+    this->_tracked = false;
+    ++this->_revision;
     // loading ideal output pattern
     for (u = 0; u < this->_parameters->nodes_out(); ++u) {
         for (v = 0; v < this->_parameters->nodes_in(); ++v) {
-            in.read((char*)&tmp, sizeof(double));
-            gsl_matrix_set(this->_ideal_pattern, u, v, tmp);
+            gsl_matrix_set(this->_ideal_pattern, u, v, in.get_f64());
         }
     }
     return iteration;
 }
 
-void
-rfn::FlowDistributionNetwork::store()
-{
-    History::iterator hist_it;
-    std::stringstream filename;
-    bfsys::ofstream output;
-    for (hist_it = this->_history->begin();
-        hist_it != this->_history->end(); ++hist_it)
-    {
-        filename << this->_network_name << "_" << hist_it->first << ".dat";
-        output.open(filename.str(), std::ios::binary);
-        hist_it->second->write_to_binary_stream(output, hist_it->first);
-        output.close();
-        filename.str("");
-    }
-}
-
 double
 rfn::FlowDistributionNetwork::compute_complexity()
 {
-    int status = 0;
-    double sum = 0.0;
-    double tmp = 0.0;
-    gsl_vector_view first;
-    gsl_vector_view second;
-    for (short unsigned i = 0; i < this->_parameters->nodes_in() - 1; ++i) {
-        for (short unsigned j = i + 1; j < this->_parameters->nodes_in(); ++j)
-        {
-            first = gsl_matrix_column(this->_ideal_pattern, i);
-            second = gsl_matrix_column(this->_ideal_pattern, j);
-            status = gsl_blas_ddot (&first.vector, &second.vector, &tmp);
-            CHECK_CRITICAL_GSL_STATUS(status, __FILE__, __LINE__);
-            sum += tmp;
-        }
-    }
-    return sum;
+    return rfn::LinearAlgebra::backend(this->_parameters->backend())->
+        complexity(this->_ideal_pattern);
 }
 
 void
@@ -334,35 +477,33 @@ rfn::FlowDistributionNetwork::recover()
     // recover from error by not allowing this mutation
     // unrealistic output pattern should ensure large flow error
     gsl_matrix_set_all(this->_output_pattern, 2.0);
+    rfn::Profile::recovery();
 }
 
 void
 rfn::FlowDistributionNetwork::prune()
 {
-    // make a colour map with all nodes set to white
-    std::vector<boost::default_color_type> colours(
-        boost::num_vertices(*this->_network),
-        boost::color_traits<boost::default_color_type>::white()
-        );
-    rfn::ColourMap colour_map(colours, *this->_network);
     // get all accessible nodes
-    this->accessible_nodes(colour_map);
+    std::vector<rfn::Adjacency::Word> accessible;
+    this->accessible_nodes(accessible);
     // control middle nodes
     for (short unsigned n = this->_parameters->nodes_in();
         n < this->_parameters->nodes_end_middle(); ++n)
     {
         // remove inaccessible nodes
-        if (boost::get(colour_map, n) == boost::white_color) {
-            boost::clear_vertex(n, *this->_network);
+        if (!rfn::Adjacency::test(&accessible[0], n)) {
+            this->_network->clear_vertex(n);
         }
         // remove virtual sources and sinks
-        else if (boost::in_degree(n, *this->_network) == 0
-            || boost::out_degree(n, *this->_network) == 0)
+        else if (this->_network->in_degree(n) == 0
+            || this->_network->out_degree(n) == 0)
         {
-            boost::clear_vertex(n, *this->_network);
+            this->_network->clear_vertex(n);
         }
     }
     this->_changed = true;
+    this->_tracked = false;
+    ++this->_revision;
 }
 
 
@@ -371,91 +512,329 @@ rfn::FlowDistributionNetwork::prune()
  ******************************************************************************/
 
 
+rfn::Workspace*
+rfn::FlowDistributionNetwork::workspace()
+{
+    if (this->_workspace == NULL) {
+        this->_workspace = new Workspace(this->_parameters);
+        CHECK_CRITICAL_POINTER(this->_workspace);
+    }
+    return this->_workspace;
+}
+
+/*
+ * 'a' differs from the reference only in the sources it tracked, the solver is
+ * updated accordingly, otherwise it is factorised anew.
+ */
 void
-rfn::FlowDistributionNetwork::compute_flow_error()
+rfn::FlowDistributionNetwork::adopt_reference(
+    const rfn::FlowDistributionNetwork& a)
+{
+    if (this->_original && this->_solver != NULL) {
+        // the accepted network becomes the new reference
+        if (a._tracked && a._solver_state == this->_solver->state()) {
+            if (!a._sources.empty()) {
+                this->_solver->update(this->_network, &a._sources[0],
+                    (unsigned)a._sources.size());
+            }
+        }
+        else {
+            this->_solver->factorise(this->_network);
+        }
+        this->_tracked = true;
+        this->_solver_state = this->_solver->state();
+        this->_sources.clear();
+    }
+}
+
+/*
+ * With 'early_exit()' the input columns are solved in portions and evaluation
+ * stops as soon as the squared error of the columns so far exceeds 'ceiling'.
+ * The full output pattern and flow error are identical to those of
+ * 'flow_error()'.
+ */
+double
+rfn::FlowDistributionNetwork::flow_error(const double ceiling)
 {
-    this->_flow_error = 0.0;
-    for (short unsigned i = 0; i < this->_parameters->nodes_out(); ++i) {
-        for (short unsigned j = 0; j < this->_parameters->nodes_in(); ++j) {
-            this->_flow_error += gsl_pow_2(
-                gsl_matrix_get(this->_ideal_pattern, (size_t)i, (size_t)j) -
-                gsl_matrix_get(this->_output_pattern, (size_t)i, (size_t)j));
+    if (!this->_changed || this->_solver != NULL
+        || !this->_parameters->early_exit())
+    {
+        // cached, evaluated by a low-rank update or not bounded at all
+        return this->flow_error();
+    }
+    const unsigned n_in = this->_parameters->nodes_in();
+    const unsigned n_out = this->_parameters->nodes_out();
+    const unsigned offset = this->_parameters->nodes_end_middle();
+    const double norm = (double)(2 * n_in);
+    rfn::Matrix* flow = this->workspace()->flow();
+    rfn::ComponentSolver& components = this->workspace()->components();
+    int status = 0;
+    if (!this->_bounded || this->_bounded_revision != this->_revision) {
+        gsl_matrix_set_zero(flow);
+        for (unsigned v = 0; v < n_in; ++v) {
+            gsl_matrix_set(flow, v, v, 1.0);
+        }
+        status = components.factorise(this->_network);
+        this->_bounded = (status == 0);
+        this->_bounded_revision = this->_revision;
+        this->_solved = 0u;
+        this->_partial_error = 0.0;
+    }
+    // every pass over the network costs about as much as one for all
+    // inputs, hence only two portions
+    const unsigned portion = (n_in + 1u) / 2u;
+    double diff = 0.0;
+    unsigned num = 0u;
+    unsigned i = 0u;
+    unsigned j = 0u;
+    while (status == 0 && this->_solved < n_in) {
+        if (gsl_fcmp(this->_partial_error / norm, ceiling,
+            GSL_SQRT_DBL_EPSILON) > 0)
+        {
+            return this->_partial_error / norm;
+        }
+        num = std::min(portion, n_in - this->_solved);
+        status = components.solve_columns(flow, this->_solved, num);
+        for (j = this->_solved; j < this->_solved + num && status == 0; ++j) {
+            for (i = 0; i < n_out; ++i) {
+                diff = gsl_matrix_get(this->_ideal_pattern, i, j) -
+                    gsl_matrix_get(flow, offset + i, j);
+                this->_partial_error += diff * diff;
+            }
         }
+        this->_solved += num;
+    }
+    this->_bounded = false;
+    if (status != 0) {
+#ifdef VERBOSE
+        std::cerr << "GSL Status Error: " << gsl_strerror(status)
+            << std::endl;
+        std::cerr << "Continuing..." << std::endl;
+#endif
+        this->recover();
     }
-    this->_flow_error /= (double)(2 * this->_parameters->nodes_in());
+    else {
+        gsl_matrix_const_view output = gsl_matrix_const_submatrix(flow,
+            offset, 0, n_out, n_in);
+        status = gsl_matrix_memcpy(this->_output_pattern, &output.matrix);
+        CHECK_CRITICAL_GSL_STATUS(status, __FILE__, __LINE__);
+    }
+    this->compute_flow_error();
+    this->_changed = false;
+    return this->_flow_error;
 }
 
+void
+rfn::FlowDistributionNetwork::compute_flow_error()
+{
+    this->_flow_error = rfn::LinearAlgebra::backend(
+        this->_parameters->backend())->squared_error(this->_ideal_pattern,
+        this->_output_pattern) /
+        (double)(2 * this->_parameters->nodes_in());
+}
+
+/*
+ * Mutated copies are evaluated against the shared low-rank solver if possible,
+ * otherwise the SLE is solved along the strongly connected components.
+ */
 void
 rfn::FlowDistributionNetwork::compute_output()
 {
-    rfn::Matrix* sle = gsl_matrix_calloc(this->_parameters->nodes_total(),
-        this->_parameters->nodes_total());
-    CHECK_CRITICAL_GSL_POINTER(sle, __FILE__, __LINE__);
-    this->generate_sle(sle);
-    this->generate_output(sle);
-    gsl_matrix_free(sle);
+    int status = 0;
+    if (this->_solver != NULL) {
+        if (this->_original) {
+            this->_solver->factorise(this->_network);
+            this->_tracked = true;
+            this->_solver_state = this->_solver->state();
+            this->_sources.clear();
+            if (this->_solver->valid()) {
+                this->_solver->output(this->_output_pattern);
+                return;
+            }
+        }
+        else if (this->_tracked && this->_solver->valid()
+            && this->_solver_state == this->_solver->state()
+            && this->_sources.size() <= this->_solver->max_rank())
+        {
+            this->compute_low_rank_output(this->_solver,
+                (this->_sources.empty()) ? NULL : &this->_sources[0],
+                (unsigned)this->_sources.size());
+            return;
+        }
+    }
+    const unsigned n_in = this->_parameters->nodes_in();
+    // flow through each node (rows) for each input node (columns)
+    rfn::Matrix* flow = this->workspace()->flow();
+    this->_bounded = false;
+    gsl_matrix_set_zero(flow);
+    for (unsigned v = 0; v < n_in; ++v) {
+        gsl_matrix_set(flow, v, v, 1.0);
+    }
+    status = this->workspace()->components().solve(this->_network, flow);
+    if (status != 0) {
+#ifdef VERBOSE
+        std::cerr << "GSL Status Error: " << gsl_strerror(status)
+            << std::endl;
+        std::cerr << "Continuing..." << std::endl;
+#endif
+        this->recover();
+    }
+    else {
+        gsl_matrix_const_view output = gsl_matrix_const_submatrix(flow,
+            this->_parameters->nodes_end_middle(), 0,
+            this->_parameters->nodes_out(), n_in);
+        status = gsl_matrix_memcpy(this->_output_pattern, &output.matrix);
+        CHECK_CRITICAL_GSL_STATUS(status, __FILE__, __LINE__);
+    }
 }
 
+/*
+ * Output pattern of a network that differs from the reference network of
+ * 'solver' only in the outgoing links of 'sources', falls back to the full
+ * evaluation if the update is not applicable.
+ */
+void
+rfn::FlowDistributionNetwork::compute_low_rank_output(
+    rfn::LowRankSolver* const solver, unsigned const* const sources,
+    const unsigned rank)
+{
+    if (!solver->valid() || rank > solver->max_rank()) {
+        this->compute_output();
+        return;
+    }
+    int status = solver->evaluate(this->_network, sources, rank,
+        this->_output_pattern);
+    if (status != 0) {
+#ifdef VERBOSE
+        std::cerr << "GSL Status Error: " << gsl_strerror(status)
+            << std::endl;
+        std::cerr << "Continuing..." << std::endl;
+#endif
+        this->recover();
+    }
+}
+
+/*
+ * Remember which columns of the SLE the last mutation changed and, for a
+ * mirror, which links it flipped.
+ */
+void
+rfn::FlowDistributionNetwork::track_mutation()
+{
+    ++this->_revision;
+    if (this->_origin != NULL) {
+        const std::vector<rfn::Mutation::Link>& changes =
+            this->_mutation->changes();
+        this->_changes.insert(this->_changes.end(), changes.begin(),
+            changes.end());
+    }
+    if (this->_solver == NULL) {
+        return;
+    }
+    const std::vector<unsigned>& sources = this->_mutation->sources();
+    for (unsigned k = 0; k < sources.size(); ++k) {
+        if (std::find(this->_sources.begin(), this->_sources.end(), sources[k])
+            == this->_sources.end()) {
+            this->_sources.push_back(sources[k]);
+        }
+    }
+}
+
+void
+rfn::FlowDistributionNetwork::rollback()
+{
+    for (unsigned k = (unsigned)this->_changes.size(); k-- > 0;) {
+        this->_network->flip_edge(this->_changes[k].first,
+            this->_changes[k].second);
+    }
+    this->_changes.clear();
+}
+
+void
+rfn::FlowDistributionNetwork::replay()
+{
+    for (unsigned k = 0; k < this->_changes.size(); ++k) {
+        this->_network->flip_edge(this->_changes[k].first,
+            this->_changes[k].second);
+    }
+}
+
+/*
+ * Input nodes receive no flow, so their rows of 'sle' are unit rows. The flow
+ * through the remaining nodes solves the trailing block of 'sle' with the
+ * negated leading columns as right hand sides, one for each input node, which
+ * are solved for all at once.
+ */
 void
 rfn::FlowDistributionNetwork::generate_output(rfn::Matrix* const sle)
 {
-    gsl_matrix_set_zero(this->_output_pattern);
-    // declare other variables
-    gsl_vector* x = gsl_vector_calloc(this->_parameters->nodes_total());
-    CHECK_CRITICAL_GSL_POINTER(x, __FILE__, __LINE__);
-    gsl_permutation* p = gsl_permutation_calloc(
-        this->_parameters->nodes_total());
-    CHECK_CRITICAL_GSL_POINTER(p, __FILE__, __LINE__);
-    gsl_vector_view output = gsl_vector_subvector(x,
-        this->_parameters->nodes_end_middle(),
-        this->_parameters->nodes_out());
-    int signum = 0;
+    const unsigned n_in = this->_parameters->nodes_in();
+    const unsigned size = this->_parameters->nodes_total() - n_in;
+    gsl_matrix_view block = gsl_matrix_submatrix(sle, n_in, n_in, size, size);
+    gsl_matrix_view rhs = gsl_matrix_submatrix(this->workspace()->flow(), 0, 0,
+        size, n_in);
+    gsl_permutation p;
+    p.size = size;
+    p.data = this->workspace()->permutation()->data;
+    rfn::LinearAlgebra const* const backend = rfn::LinearAlgebra::backend(
+        this->_parameters->backend());
     // decompose matrix
     int status = 0;
-    status = gsl_linalg_LU_decomp(sle, p, &signum);
+    {
+        rfn::Profile::Scope scope(rfn::Profile::factorise);
+        status = backend->factorise(&block.matrix, &p);
+    }
     if (status != 0) {
-        throw "Warning: Possibly singular matrix.";
+        // may run in a worker thread, thus rejected rather than thrown
+        std::cerr << "GSL Status Error: " << gsl_strerror(status)
+            << std::endl;
+        std::cerr << "Continuing..." << std::endl;
+        this->recover();
+        return;
     }
-    for (short unsigned n = 0; n < this->_parameters->nodes_in(); ++n) {
-        // re-initialise new input node
-        status = gsl_vector_set_basis(x, n);
-        CHECK_CRITICAL_GSL_STATUS(status, __FILE__, __LINE__);
-        status = gsl_linalg_LU_svx(sle, p, x);
-        if (status != 0) {
-            std::cerr << "GSL Status Error: " << gsl_strerror(status)
-                << std::endl;
-//            this->print_gsl_matrix(sle);
-            std::cerr << "Continuing..." << std::endl;
-            break;
+    rfn::Profile::Scope scope(rfn::Profile::solve);
+    // the flow buffer no longer holds a bounded evaluation
+    this->_bounded = false;
+    const double* source = NULL;
+    double* target = NULL;
+    for (unsigned a = 0; a < size; ++a) {
+        source = sle->data + (n_in + p.data[a]) * sle->tda;
+        target = rhs.matrix.data + a * rhs.matrix.tda;
+        for (unsigned j = 0; j < n_in; ++j) {
+            target[j] = -source[j];
         }
-        CHECK_CRITICAL_GSL_STATUS(status, __FILE__, __LINE__);
-        status = gsl_matrix_set_col(this->_output_pattern, (size_t)n,
-            &output.vector);
-        CHECK_CRITICAL_GSL_STATUS(status, __FILE__, __LINE__);
     }
+    status = backend->solve(&block.matrix, &rhs.matrix);
     if (status != 0) {
+        std::cerr << "GSL Status Error: " << gsl_strerror(status)
+            << std::endl;
+        std::cerr << "Continuing..." << std::endl;
         this->recover();
+        return;
     }
-    gsl_vector_free(x);
-    gsl_permutation_free(p);
+    gsl_matrix_const_view output = gsl_matrix_const_submatrix(&rhs.matrix,
+        this->_parameters->nodes_end_middle() - n_in, 0,
+        this->_parameters->nodes_out(), n_in);
+    status = gsl_matrix_memcpy(this->_output_pattern, &output.matrix);
+    CHECK_CRITICAL_GSL_STATUS(status, __FILE__, __LINE__);
 }
 
 void
 rfn::FlowDistributionNetwork::generate_sle(rfn::Matrix* const sle)
 {
+    rfn::Profile::Scope scope(rfn::Profile::build);
     // set up the system, where each row 1 * 'i' minus all the incident edges
     // from sources 'j' / out-degree('j')
-    boost::graph_traits<rfn::Adjacency>::in_edge_iterator ieit, ieit_end;
+    rfn::Adjacency::Iterator ieit, ieit_end;
     gsl_matrix_set_identity(sle);
     for (short unsigned i = this->_parameters->nodes_in() - 1;
         i < this->_parameters->nodes_total(); ++i)
     {
-        for (boost::tie(ieit, ieit_end) = boost::in_edges(i, *(this->_network));
+        for (boost::tie(ieit, ieit_end) = this->_network->in_neighbours(i);
             ieit != ieit_end; ++ieit)
         {
-            gsl_matrix_set(sle, i, boost::source(*ieit, *(this->_network)),
-                -1.0 / (double)boost::out_degree(
-                boost::source(*ieit, *(this->_network)), *(this->_network)));
+            gsl_matrix_set(sle, i, *ieit,
+                -1.0 / (double)this->_network->out_degree(*ieit));
         }
     }
 }
@@ -482,17 +861,39 @@ rfn::FlowDistributionNetwork::print_gsl_matrix(rfn::Matrix* m)
  * Generate a map of accessible nodes
  */
 void
-rfn::FlowDistributionNetwork::accessible_nodes(rfn::ColourMap& colour_map)
+rfn::FlowDistributionNetwork::accessible_nodes(
+    std::vector<rfn::Adjacency::Word>& accessible)
 {
-    // queue for discovered nodes
-    boost::queue<rfn::Vertex> queue;
-    // bfs visitor
-    boost::bfs_visitor<boost::null_visitor> vis;
-    
+    accessible.assign(this->_network->words(), 0ul);
     for (short unsigned n = 0; n < this->_parameters->nodes_in(); ++n) {
-        // use breadth first visit which is a bfs that does not initialise the
-        // colour map itself
-        boost::breadth_first_visit(*this->_network, n, queue, vis,
-            colour_map);
+        accessible[n / rfn::Adjacency::BITS] |=
+            1ul << (n % rfn::Adjacency::BITS);
+    }
+    this->_network->reachable(&accessible[0]);
+}
+
+/*
+ * The run is described in the archive by the first record of this network.
+ */
+unsigned
+rfn::FlowDistributionNetwork::archive_run(rfn::Archive& archive)
+{
+    unsigned id = archive.find(this->_network_name);
+    if (id != rfn::Archive::npos) {
+        return id;
     }
-}
\ No newline at end of file
+    rfn::Archive::Run run;
+    run.name = this->_network_name;
+    run.seed = this->_parameters->seed();
+    run.connectivity = this->_parameters->connectivity();
+    run.nodes_in = this->_parameters->nodes_in();
+    run.nodes_middle = this->_parameters->nodes_middle();
+    run.nodes_out = this->_parameters->nodes_out();
+    run.pattern.reserve(run.nodes_out * run.nodes_in);
+    for (unsigned i = 0; i < run.nodes_out; ++i) {
+        for (unsigned j = 0; j < run.nodes_in; ++j) {
+            run.pattern.push_back(gsl_matrix_get(this->_ideal_pattern, i, j));
+        }
+    }
+    return archive.add(run);
+}
@@ -21,7 +21,7 @@
 
 
 // std
-#include <map>
+#include <vector>
 
 // project
 #include "common_definitions.hpp"
@@ -29,6 +29,10 @@
 #include "C_NetworkInitialiser.hpp"
 #include "C_PatternInitialiser.hpp"
 #include "C_Mutation.hpp"
+#include "C_ComponentSolver.hpp"
+#include "C_LowRankSolver.hpp"
+#include "C_Workspace.hpp"
+#include "C_Archive.hpp"
 
 
 /*******************************************************************************
@@ -41,11 +45,8 @@ namespace rfn {
     class FlowDistributionNetwork {
 
     protected:
-        typedef std::map<unsigned long, FlowDistributionNetwork*> History;
-        typedef std::pair<History::iterator, bool> HistoryInsertReturn;
         /* Data Members */
         bool _original;
-        bool _not_assigned;
         bool _changed;
         double _flow_error;
         std::string _network_name;
@@ -56,7 +57,29 @@ namespace rfn {
         PatternInitialiser* _pattern_init;
         Mutation* _mutation;
         ParameterManager* _parameters;
-        History* _history;
+        // shared by all copies, NULL unless incremental evaluation is used
+        LowRankSolver* _solver;
+        // network differs from the '_solver' reference '_solver_state' only in
+        // the outgoing links of '_sources'
+        bool _tracked;
+        unsigned long _solver_state;
+        std::vector<unsigned> _sources;
+        // created on first use, never shared with copies
+        Workspace* _workspace;
+        // counts changes of '_network'
+        unsigned long _revision;
+        // a copy that mirrors '_origin' at '_origin_revision' differs from it
+        // only in the links flipped by its mutations since
+        FlowDistributionNetwork const* _origin;
+        unsigned long _origin_revision;
+        std::vector<Mutation::Link> _changes;
+        // a bounded evaluation of revision '_bounded_revision' has solved the
+        // first '_solved' input columns in the workspace with squared error
+        // '_partial_error'
+        bool _bounded;
+        unsigned long _bounded_revision;
+        unsigned _solved;
+        double _partial_error;
 
     public:
         /* Constructors & Destructor */
@@ -74,20 +97,46 @@ namespace rfn {
         virtual FlowDistributionNetwork& operator=(FlowDistributionNetwork& a);
 
         /* Member Functions */
-        // store all networks in history to files
-        void store();
+        // turn this copy into a copy of 'c' without allocating memory, only
+        // the mutations since the last call are undone if possible
+        virtual void copy(const FlowDistributionNetwork& c);
+        // take over the state of the copy 'a', if 'a' mirrors this network
+        // its mutations are replayed so that it remains a mirror
+        virtual void exchange(FlowDistributionNetwork& a);
+        // copy of this network that is recycled on every call, it stays valid
+        // until the next call or the destruction of this network
+        FlowDistributionNetwork* candidate()
+        {
+            return this->workspace()->candidate(this);
+        }
+        // 'num' copies of this network that can be evolved in other threads,
+        // recycled like 'candidate()'
+        std::vector<FlowDistributionNetwork*>& population(const unsigned num)
+        {
+            return this->workspace()->population(this, num);
+        }
         // save this object to a binary stream
-        virtual void write_to_binary_stream(bfsys::ofstream& out,
+        virtual void write_to_binary_stream(BinaryWriter& out,
             const unsigned long iteration);
+        // state of this object as a record of 'kind' in 'archive'
+        void archive_record(Archive& archive, const Archive::Kind kind,
+            const unsigned long iteration, Archive::Record& record);
+        // state of this object as an archive record
+        virtual void write_to_record(Archive::Record& record);
         // read this object from a binary stream
-        virtual unsigned long read_from_binary_stream(bfsys::ifstream& in);
-        // record the current network status
-        void save(const unsigned long time);
+        virtual unsigned long read_from_binary_stream(BinaryReader& in);
+        // everything needed to continue evolving this object, including what
+        // is otherwise recomputed
+        virtual void write_checkpoint(BinaryWriter& out,
+            const unsigned long iteration);
+        // replace the state of this object by a checkpoint
+        virtual void read_checkpoint(BinaryReader& in);
         // change the network
         virtual void mutate()
         {
             this->_changed = true;
             this->_mutation->mutate(this->_network);
+            this->track_mutation();
         }
         // compute complexity of the output pattern
         double compute_complexity();
@@ -98,12 +147,12 @@ namespace rfn {
         // get number of nodes
         unsigned int num_nodes() const
         {
-            return (unsigned int)boost::num_vertices(*this->_network);
+            return this->_network->num_vertices();
         }
         // get number of links
         unsigned int num_links() const
         {
-            return (unsigned int)boost::num_edges(*this->_network);
+            return this->_network->num_edges();
         }
         // difference between actual and ideal output pattern
         double flow_error()
@@ -115,6 +164,9 @@ namespace rfn {
             }
             return this->_flow_error;
         }
+        // the flow error if it does not exceed 'ceiling', a lower bound above
+        // 'ceiling' otherwise, another call resumes the evaluation
+        double flow_error(const double ceiling);
         // _network_name get method
         std::string name() const
         {
@@ -135,19 +187,41 @@ namespace rfn {
         {
             return this->_network;
         }
-        History* history()
+        // _mutation set method
+        void mutation(Mutation* const m)
+        {
+            this->_mutation = m;
+        }
+        // detach a copy from the solver it shares with the original so that
+        // it can be evolved in another thread
+        void isolate()
         {
-            return this->_history;
+            this->_solver = NULL;
+            this->_tracked = false;
+            this->_sources.clear();
         }
 
     protected:
         /* Internal Functions */
+        Workspace* workspace();
+        // make the network of 'a' the solver reference if this is the original
+        void adopt_reference(const FlowDistributionNetwork& a);
         void compute_flow_error();
         void compute_output();
+        void compute_low_rank_output(LowRankSolver* const solver,
+            unsigned const* const sources, const unsigned rank);
+        void track_mutation();
+        // flip the logged links in reverse order and clear the log
+        void rollback();
+        // flip the logged links in order
+        void replay();
         void generate_output(Matrix* const sle);
         void generate_sle(Matrix* const sle);
         void print_gsl_matrix(Matrix* const m);
-        void accessible_nodes(ColourMap& colour_map);
+        // one bit per node reachable from the input layer
+        void accessible_nodes(std::vector<Adjacency::Word>& accessible);
+        // id of the run of this network in 'archive'
+        unsigned archive_run(Archive& archive);
 
     }; // class FlowDistributionNetwork
 
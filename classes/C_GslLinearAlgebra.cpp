@@ -0,0 +1,112 @@
+/*******************************************************************************
+ * filename:    C_GslLinearAlgebra.cpp
+ * description: Implementation of 'GslLinearAlgebra' class
+ * author:      agent
+ * created:     2026-10-17
+ * copyright:   Jacobs University Bremen. All rights reserved.
+ ******************************************************************************/
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+
+// std
+#include <cstdlib>
+#include <iostream>
+
+// gsl
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_linalg.h>
+#include <gsl/gsl_blas.h>
+
+// project
+#include "C_GslLinearAlgebra.hpp"
+
+
+/*******************************************************************************
+ * Constructors & Destructor
+ ******************************************************************************/
+
+
+/*
+ * Default constructor
+ */
+rfn::GslLinearAlgebra::GslLinearAlgebra():
+    rfn::LinearAlgebra()
+{}
+
+/*
+ * Destructor
+ */
+rfn::GslLinearAlgebra::~GslLinearAlgebra()
+{}
+
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+
+
+int
+rfn::GslLinearAlgebra::factorise(rfn::Matrix* const sle,
+    gsl_permutation* const p) const
+{
+    int signum = 0;
+    return gsl_linalg_LU_decomp(sle, p, &signum);
+}
+
+int
+rfn::GslLinearAlgebra::solve(const rfn::Matrix* const lu,
+    rfn::Matrix* const rhs) const
+{
+    int status = rfn::LinearAlgebra::check_singular(lu);
+    if (status != 0) {
+        return status;
+    }
+    status = gsl_blas_dtrsm(CblasLeft, CblasLower, CblasNoTrans, CblasUnit,
+        1.0, lu, rhs);
+    if (status != 0) {
+        return status;
+    }
+    return gsl_blas_dtrsm(CblasLeft, CblasUpper, CblasNoTrans, CblasNonUnit,
+        1.0, lu, rhs);
+}
+
+double
+rfn::GslLinearAlgebra::squared_error(const rfn::Matrix* const a,
+    const rfn::Matrix* const b) const
+{
+    double sum = 0.0;
+    for (size_t i = 0; i < a->size1; ++i) {
+        for (size_t j = 0; j < a->size2; ++j) {
+            sum += gsl_pow_2(gsl_matrix_get(a, i, j) - gsl_matrix_get(b, i, j));
+        }
+    }
+    return sum;
+}
+
+double
+rfn::GslLinearAlgebra::complexity(const rfn::Matrix* const pattern) const
+{
+    int status = 0;
+    double sum = 0.0;
+    double tmp = 0.0;
+    gsl_vector_const_view one;
+    gsl_vector_const_view other;
+    for (size_t first = 0; first + 1 < pattern->size2; ++first) {
+        one = gsl_matrix_const_column(pattern, first);
+        for (size_t second = first + 1; second < pattern->size2; ++second) {
+            other = gsl_matrix_const_column(pattern, second);
+            status = gsl_blas_ddot(&one.vector, &other.vector, &tmp);
+            CHECK_CRITICAL_GSL_STATUS(status, __FILE__, __LINE__);
+            sum += tmp;
+        }
+    }
+    return sum;
+}
+
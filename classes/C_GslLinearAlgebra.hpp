@@ -0,0 +1,59 @@
+/*******************************************************************************
+ * filename:    C_GslLinearAlgebra.hpp
+ * description: Reference linear algebra backend built on GSL
+ * author:      agent
+ * created:     2026-10-17
+ * copyright:   Jacobs University Bremen. All rights reserved.
+ *******************************************************************************
+ * Factorises with 'gsl_linalg_LU_decomp', solves with two triangular solves of
+ * 'gsl_blas_dtrsm' and compares patterns element by element and column pair by
+ * column pair. Its results differ from those of the dense backend in rounding
+ * only.
+ ******************************************************************************/
+
+
+#ifndef _C_GSLLINEARALGEBRA_HPP
+#define	_C_GSLLINEARALGEBRA_HPP
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+
+// project
+#include "C_LinearAlgebra.hpp"
+
+
+/*******************************************************************************
+ * Declarations
+ ******************************************************************************/
+
+
+namespace rfn {
+
+    class GslLinearAlgebra: public LinearAlgebra {
+
+    public:
+        /* Constructors & Destructor */
+        GslLinearAlgebra();
+        virtual ~GslLinearAlgebra();
+
+        /* Member Functions */
+        virtual const char* name() const
+        {
+            return "gsl";
+        }
+        virtual int factorise(Matrix* const sle, gsl_permutation* const p)
+            const;
+        virtual int solve(const Matrix* const lu, Matrix* const rhs) const;
+        virtual double squared_error(const Matrix* const a,
+            const Matrix* const b) const;
+        virtual double complexity(const Matrix* const pattern) const;
+
+    }; // class GslLinearAlgebra
+
+} // namespace rfn
+
+
+#endif	// _C_GSLLINEARALGEBRA_HPP
@@ -0,0 +1,103 @@
+/*******************************************************************************
+ * filename:    C_LinearAlgebra.cpp
+ * description: Implementation of 'LinearAlgebra' class
+ * author:      agent
+ * created:     2026-10-17
+ * copyright:   Jacobs University Bremen. All rights reserved.
+ ******************************************************************************/
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+
+// gsl
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_matrix.h>
+
+// project
+#include "C_LinearAlgebra.hpp"
+#include "C_GslLinearAlgebra.hpp"
+#include "C_DenseLinearAlgebra.hpp"
+
+
+/*******************************************************************************
+ * Constructors & Destructor
+ ******************************************************************************/
+
+
+/*
+ * Default constructor
+ */
+rfn::LinearAlgebra::LinearAlgebra()
+{}
+
+/*
+ * Destructor
+ */
+rfn::LinearAlgebra::~LinearAlgebra()
+{}
+
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+
+
+rfn::LinearAlgebra const*
+rfn::LinearAlgebra::backend(const rfn::BackendScheme scheme)
+{
+    static const rfn::GslLinearAlgebra gsl;
+    static const rfn::DenseLinearAlgebra dense;
+    switch (scheme) {
+        case rfn::gsl_backend:
+            return &gsl;
+        default:
+            return &dense;
+    }
+}
+
+/*
+ * Unit diagonal and -1 / out-degree('j') at element ij for every link from 'j'
+ * to 'i' within the subnetwork.
+ */
+void
+rfn::LinearAlgebra::assemble(rfn::Adjacency const* const network,
+    unsigned const* const nodes, const unsigned size,
+    const std::vector<unsigned>& local, rfn::Matrix* const sle) const
+{
+    rfn::Adjacency::Iterator oeit, oeit_end;
+    gsl_matrix_set_identity(sle);
+    double weight = 0.0;
+    unsigned b = 0u;
+    for (unsigned a = 0; a < size; ++a) {
+        weight = -1.0 / (double)network->out_degree(nodes[a]);
+        for (boost::tie(oeit, oeit_end) = network->out_neighbours(nodes[a]);
+            oeit != oeit_end; ++oeit)
+        {
+            b = local[*oeit];
+            if (b < size) {
+                gsl_matrix_set(sle, b, a, weight);
+            }
+        }
+    }
+}
+
+
+/*******************************************************************************
+ * Internal Functions
+ ******************************************************************************/
+
+
+int
+rfn::LinearAlgebra::check_singular(const rfn::Matrix* const lu)
+{
+    for (size_t i = 0; i < lu->size1; ++i) {
+        if (lu->data[i * lu->tda + i] == 0.0) {
+            return GSL_EDOM;
+        }
+    }
+    return GSL_SUCCESS;
+}
+
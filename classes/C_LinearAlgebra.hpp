@@ -0,0 +1,97 @@
+/*******************************************************************************
+ * filename:    C_LinearAlgebra.hpp
+ * description: Interface of the linear algebra backends
+ * author:      agent
+ * created:     2026-10-17
+ * copyright:   Jacobs University Bremen. All rights reserved.
+ *******************************************************************************
+ * The numerical work of an evaluation, i.e., assembling and factorising the
+ * dense SLE of a network or one of its cyclic components, solving it for a
+ * block of right hand sides and comparing output patterns, goes through a
+ * backend chosen once at startup with '--backend'. The GSL backend is the
+ * reference and the default. The dense backend is the faster in-house
+ * implementation. It sums the pattern measures in the eight lanes of
+ * 'PatternKernels' rather than element by element, hence its flow errors and
+ * complexities differ from the reference in the last bits and evolutions
+ * with the same seed diverge.
+ *
+ * Backends hold no state and are shared by all threads. Sparse factorisations
+ * of cyclic components remain with 'SparseLU' and are chosen with '--solver'.
+ ******************************************************************************/
+
+
+#ifndef _C_LINEARALGEBRA_HPP
+#define	_C_LINEARALGEBRA_HPP
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+
+// std
+#include <vector>
+
+// gsl
+#include <gsl/gsl_permutation.h>
+
+// project
+#include "common_definitions.hpp"
+
+
+/*******************************************************************************
+ * Declarations
+ ******************************************************************************/
+
+
+namespace rfn {
+
+    class LinearAlgebra {
+
+    public:
+        /* Constructors & Destructor */
+        virtual ~LinearAlgebra();
+
+        /* Member Functions */
+        // backend of 'scheme'
+        static LinearAlgebra const* backend(const BackendScheme scheme);
+        // name of the backend as given on the command line
+        virtual const char* name() const = 0;
+        // SLE of the subnetwork spanned by 'nodes', 'local' maps every node
+        // of the network to its position in 'nodes' or to 'size' otherwise
+        void assemble(Adjacency const* const network,
+            unsigned const* const nodes, const unsigned size,
+            const std::vector<unsigned>& local, Matrix* const sle) const;
+        // LU decomposition of 'sle' in place with partial pivoting, returns a
+        // gsl status
+        virtual int factorise(Matrix* const sle, gsl_permutation* const p)
+            const = 0;
+        // 'rhs' holds the right hand sides in pivot order on entry and the
+        // solutions on return, returns a gsl status
+        virtual int solve(const Matrix* const lu, Matrix* const rhs)
+            const = 0;
+        // sum of the squared differences of two patterns of equal size
+        virtual double squared_error(const Matrix* const a,
+            const Matrix* const b) const = 0;
+        // sum of the dot products of all pairs of distinct columns
+        virtual double complexity(const Matrix* const pattern) const = 0;
+
+    protected:
+        /* Constructors & Destructor */
+        LinearAlgebra();
+
+        /* Internal Functions */
+        // 'GSL_EDOM' if a factor has a zero on its diagonal
+        static int check_singular(const Matrix* const lu);
+
+    private:
+        // not copyable
+        LinearAlgebra(const LinearAlgebra&);
+        LinearAlgebra& operator=(const LinearAlgebra&);
+
+    }; // class LinearAlgebra
+
+} // namespace rfn
+
+
+#endif	// _C_LINEARALGEBRA_HPP
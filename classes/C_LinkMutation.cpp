@@ -85,13 +85,16 @@ rfn::LinkMutation::mutate(rfn::Adjacency* const network)
     do {
         tar = (*this->_node_gen)();
     } while (!rfn::Mutation::_parameters->regards_structure(src, tar));
+    this->_sources.clear();
+    this->_changes.clear();
+    this->touched(src);
     if ((*this->_bool_gen)()) {
         // add potentially new link
-        boost::add_edge(src, tar, *network);
+        this->add_edge(network, src, tar);
     }
     else {
         // remove potentially existing link
-        boost::remove_edge(src, tar, *network);
+        this->remove_edge(network, src, tar);
     }
 }
 
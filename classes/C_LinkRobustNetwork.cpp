@@ -135,28 +135,32 @@ void
 rfn::LinkRobustNetwork::compute_robustness()
 {
     this->_robustness = 0.0;
-    // make a colour map with all nodes set to white
-    std::vector<boost::default_color_type> colours(this->num_nodes(),
-        boost::color_traits<boost::default_color_type>::white());
-    rfn::ColourMap colour_map(colours, *this->_network);
     // get all accessible nodes
-    this->accessible_nodes(colour_map);
+    std::vector<rfn::Adjacency::Word> accessible;
+    this->accessible_nodes(accessible);
     short unsigned i = 0;
     short unsigned src = 0;
     short unsigned tar = 0;
-    boost::graph_traits<Adjacency>::out_edge_iterator eit, eit_end;
+    rfn::Adjacency::Iterator eit, eit_end;
+    unsigned source = 0u;
     rfn::LinkRobustNetwork next(*this);
+    // links are removed behind the back of incremental evaluation
+    next._tracked = false;
+    // every knockout changes a single column of the intact SLE
+    rfn::LowRankSolver solver(this->_parameters);
+    solver.factorise(this->_network);
     // control input nodes
     for (short unsigned n = 0; n < this->_parameters->nodes_in(); ++n)
     {
-        for (boost::tie(eit, eit_end) = boost::out_edges(n, *this->_network);
+        for (boost::tie(eit, eit_end) = this->_network->out_neighbours(n);
             eit != eit_end; ++eit)
         {
             // delete link
-            src = boost::source(*eit, *next._network);
-            tar = boost::target(*eit, *next._network);
-            boost::remove_edge(src, tar, *next._network);
-            next.compute_output();
+            src = n;
+            tar = *eit;
+            next._network->remove_edge(src, tar);
+            source = src;
+            next.compute_low_rank_output(&solver, &source, 1u);
             next.compute_flow_error();
             if (gsl_fcmp(next._flow_error,
                 this->_robust_parameters->robust_threshold(),
@@ -165,7 +169,7 @@ rfn::LinkRobustNetwork::compute_robustness()
                 this->_robustness += 1.0;
             }
             // reset the network
-            boost::add_edge(src, tar, *next._network);
+            next._network->add_edge(src, tar);
             ++i;
         }
     }
@@ -175,19 +179,20 @@ rfn::LinkRobustNetwork::compute_robustness()
     {
 // reversion to initial state
 //        // only links from accessible nodes should be considered for robustness
-//        if (boost::get(colour_map, n) != boost::white_color) {
+//        if (rfn::Adjacency::test(&accessible[0], n)) {
             // disregard virtual sources and sinks in the middle layer
-            if (boost::in_degree(n, *this->_network) >= 1
-                    && boost::out_degree(n, *this->_network) >= 1)
+            if (this->_network->in_degree(n) >= 1
+                    && this->_network->out_degree(n) >= 1)
             {
                 for (boost::tie(eit, eit_end) =
-                    boost::out_edges(n, *this->_network); eit != eit_end; ++eit)
+                    this->_network->out_neighbours(n); eit != eit_end; ++eit)
                 {
                     // delete link
-                    src = boost::source(*eit, *next._network);
-                    tar = boost::target(*eit, *next._network);
-                    boost::remove_edge(src, tar, *next._network);
-                    next.compute_output();
+                    src = n;
+                    tar = *eit;
+                    next._network->remove_edge(src, tar);
+                    source = src;
+                    next.compute_low_rank_output(&solver, &source, 1u);
                     next.compute_flow_error();
                     if (gsl_fcmp(next._flow_error,
                         this->_robust_parameters->robust_threshold(),
@@ -196,7 +201,7 @@ rfn::LinkRobustNetwork::compute_robustness()
                         this->_robustness += 1.0;
                     }
                     // reset the network
-                    boost::add_edge(src, tar, *next._network);
+                    next._network->add_edge(src, tar);
                     ++i;
                 }
             }
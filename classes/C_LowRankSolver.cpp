@@ -0,0 +1,424 @@
+/*******************************************************************************
+ * filename:    C_LowRankSolver.cpp
+ * description: Implementation of 'LowRankSolver' class
+ * author:      agent
+ * created:     2026-10-17
+ * copyright:   Jacobs University Bremen. All rights reserved.
+ *******************************************************************************
+ * For a reference SLE A with known inverse and a network whose SLE A' differs
+ * in the columns C, A' = A + U * E_C^T where U holds the column differences and
+ * E_C selects the columns C. Then
+ *
+ *     A'^-1 = A^-1 - W * S^-1 * A^-1(C, :)
+ *
+ * with W = A^-1 * U and the small capacitance matrix S = I + W(C, :). The
+ * output pattern are the output rows of the first 'nodes_in' columns of the
+ * inverse.
+ ******************************************************************************/
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+
+// std
+#include <cmath>
+#include <algorithm>
+
+// gsl
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_matrix.h>
+
+// project
+#include "C_LowRankSolver.hpp"
+#include "C_Profile.hpp"
+
+
+/*******************************************************************************
+ * Constructors & Destructor
+ ******************************************************************************/
+
+
+/*
+ * Default constructor, more than 16 changed columns are cheaper to handle by a
+ * new factorisation and the inverse is refreshed every 64 updates to keep
+ * rounding errors from accumulating.
+ */
+rfn::LowRankSolver::LowRankSolver(rfn::ParameterManager* const parameters):
+    _state(0ul),
+    _max_rank(std::min(16u, parameters->nodes_total())),
+    _refresh(64u),
+    _updates(0u),
+    _valid(false),
+    _parameters(parameters),
+    _columns(NULL),
+    _inverse(NULL),
+    _components(parameters),
+    _delta(NULL),
+    _w(NULL),
+    _capacitance(NULL),
+    _rhs(NULL),
+    _column(NULL),
+    _support(),
+    _offsets()
+{
+    const unsigned n = this->_parameters->nodes_total();
+    this->_columns = gsl_matrix_calloc(n, n);
+    CHECK_CRITICAL_GSL_POINTER(this->_columns, __FILE__, __LINE__);
+    this->_inverse = gsl_matrix_calloc(n, n);
+    CHECK_CRITICAL_GSL_POINTER(this->_inverse, __FILE__, __LINE__);
+    this->_delta = gsl_matrix_calloc(this->_max_rank, n);
+    CHECK_CRITICAL_GSL_POINTER(this->_delta, __FILE__, __LINE__);
+    this->_w = gsl_matrix_calloc(n, this->_max_rank);
+    CHECK_CRITICAL_GSL_POINTER(this->_w, __FILE__, __LINE__);
+    this->_capacitance = gsl_matrix_calloc(this->_max_rank, this->_max_rank);
+    CHECK_CRITICAL_GSL_POINTER(this->_capacitance, __FILE__, __LINE__);
+    this->_rhs = gsl_matrix_calloc(this->_max_rank, n);
+    CHECK_CRITICAL_GSL_POINTER(this->_rhs, __FILE__, __LINE__);
+    this->_column = gsl_vector_calloc(n);
+    CHECK_CRITICAL_GSL_POINTER(this->_column, __FILE__, __LINE__);
+    this->_support.reserve(n * this->_max_rank);
+    this->_offsets.reserve(this->_max_rank + 1);
+}
+
+/*
+ * Destructor
+ */
+rfn::LowRankSolver::~LowRankSolver()
+{
+    gsl_matrix_free(this->_columns);
+    this->_columns = NULL;
+    gsl_matrix_free(this->_inverse);
+    this->_inverse = NULL;
+    gsl_matrix_free(this->_delta);
+    this->_delta = NULL;
+    gsl_matrix_free(this->_w);
+    this->_w = NULL;
+    gsl_matrix_free(this->_capacitance);
+    this->_capacitance = NULL;
+    gsl_matrix_free(this->_rhs);
+    this->_rhs = NULL;
+    gsl_vector_free(this->_column);
+    this->_column = NULL;
+    this->_parameters = NULL; // singleton destroys itself
+}
+
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+
+
+/*
+ * The inverse is the flow through every node for a unit injection at each
+ * node, which the component-wise solution yields in a single pass over all
+ * edges per node for acyclic networks. A singular reference is remembered as
+ * such, every evaluation against it fails until the next successful
+ * factorisation.
+ */
+int
+rfn::LowRankSolver::factorise(rfn::Adjacency const* const network)
+{
+    rfn::Profile::Scope scope(rfn::Profile::build);
+    const unsigned n = this->_parameters->nodes_total();
+    int status = 0;
+    for (unsigned j = 0; j < n; ++j) {
+        gsl_vector_view column = gsl_matrix_row(this->_columns, j);
+        this->generate_column(network, j, &column.vector);
+    }
+    gsl_matrix_set_identity(this->_inverse);
+    status = this->_components.solve(network, this->_inverse);
+    this->_valid = (status == 0);
+    this->_updates = 0u;
+    ++this->_state;
+    return status;
+}
+
+int
+rfn::LowRankSolver::evaluate(rfn::Adjacency const* const network,
+    unsigned const* const sources, const unsigned rank,
+    rfn::Matrix* const output)
+{
+    if (!this->_valid) {
+        return GSL_ESING;
+    }
+    if (rank > this->_max_rank) {
+        return GSL_EBADLEN;
+    }
+    if (rank == 0) {
+        this->output(output);
+        return GSL_SUCCESS;
+    }
+    rfn::Profile::Scope scope(rfn::Profile::solve);
+    const unsigned n_in = this->_parameters->nodes_in();
+    const unsigned n_out = this->_parameters->nodes_out();
+    const unsigned offset = this->_parameters->nodes_end_middle();
+    this->generate_delta(network, sources, rank);
+    this->multiply(rank);
+    int status = this->solve_capacitance(sources, rank, n_in);
+    if (status != 0) {
+        return status;
+    }
+    for (unsigned o = 0; o < n_out; ++o) {
+        double const* inv = gsl_matrix_const_ptr(this->_inverse, offset + o, 0);
+        double const* w = gsl_matrix_const_ptr(this->_w, offset + o, 0);
+        double* out = gsl_matrix_ptr(output, o, 0);
+        for (unsigned j = 0; j < n_in; ++j) {
+            out[j] = inv[j];
+        }
+        for (unsigned k = 0; k < rank; ++k) {
+            double const* rhs = gsl_matrix_const_ptr(this->_rhs, k, 0);
+            for (unsigned j = 0; j < n_in; ++j) {
+                out[j] -= w[k] * rhs[j];
+            }
+        }
+    }
+    return GSL_SUCCESS;
+}
+
+/*
+ * Falls back to a new factorisation when the update is too large, the
+ * reference is singular, or enough updates have accumulated.
+ */
+int
+rfn::LowRankSolver::update(rfn::Adjacency const* const network,
+    unsigned const* const sources, const unsigned rank)
+{
+    if (!this->_valid || rank > this->_max_rank ||
+        this->_updates + 1u >= this->_refresh)
+    {
+        return this->factorise(network);
+    }
+    rfn::Profile::Scope scope(rfn::Profile::factorise);
+    const unsigned n = this->_parameters->nodes_total();
+    this->generate_delta(network, sources, rank);
+    this->multiply(rank);
+    int status = this->solve_capacitance(sources, rank, n);
+    if (status != 0) {
+        // the new reference is singular
+        return this->factorise(network);
+    }
+    unsigned k = 0u;
+    for (unsigned i = 0; i < n; ++i) {
+        double* inv = gsl_matrix_ptr(this->_inverse, i, 0);
+        double const* w = gsl_matrix_const_ptr(this->_w, i, 0);
+        for (k = 0; k < rank; ++k) {
+            if (w[k] == 0.0) {
+                continue;
+            }
+            double const* rhs = gsl_matrix_const_ptr(this->_rhs, k, 0);
+            for (unsigned j = 0; j < n; ++j) {
+                inv[j] -= w[k] * rhs[j];
+            }
+        }
+    }
+    for (k = 0; k < rank; ++k) {
+        double* column = gsl_matrix_ptr(this->_columns, sources[k], 0);
+        double const* delta = gsl_matrix_const_ptr(this->_delta, k, 0);
+        for (unsigned i = 0; i < n; ++i) {
+            column[i] += delta[i];
+        }
+    }
+    ++this->_updates;
+    ++this->_state;
+    return GSL_SUCCESS;
+}
+
+void
+rfn::LowRankSolver::output(rfn::Matrix* const output) const
+{
+    gsl_matrix_const_view view = gsl_matrix_const_submatrix(this->_inverse,
+        this->_parameters->nodes_end_middle(), 0,
+        this->_parameters->nodes_out(), this->_parameters->nodes_in());
+    int status = gsl_matrix_memcpy(output, &view.matrix);
+    CHECK_CRITICAL_GSL_STATUS(status, __FILE__, __LINE__);
+}
+
+void
+rfn::LowRankSolver::write_checkpoint(rfn::BinaryWriter& out) const
+{
+    const unsigned n = this->_parameters->nodes_total();
+    out.put_u16(this->_valid);
+    out.put_u32(this->_updates);
+    for (unsigned i = 0; i < n; ++i) {
+        for (unsigned j = 0; j < n; ++j) {
+            out.put_f64(gsl_matrix_get(this->_columns, i, j));
+            out.put_f64(gsl_matrix_get(this->_inverse, i, j));
+        }
+    }
+}
+
+void
+rfn::LowRankSolver::read_checkpoint(rfn::BinaryReader& in)
+{
+    const unsigned n = this->_parameters->nodes_total();
+    this->_valid = (in.get_u16() != 0u);
+    this->_updates = in.get_u32();
+    for (unsigned i = 0; i < n; ++i) {
+        for (unsigned j = 0; j < n; ++j) {
+            gsl_matrix_set(this->_columns, i, j, in.get_f64());
+            gsl_matrix_set(this->_inverse, i, j, in.get_f64());
+        }
+    }
+    ++this->_state;
+}
+
+
+/*******************************************************************************
+ * Internal Functions
+ ******************************************************************************/
+
+
+/*
+ * Column 'j' of the SLE, the unit diagonal and -1 / out-degree('j') for every
+ * target of 'j'.
+ */
+void
+rfn::LowRankSolver::generate_column(rfn::Adjacency const* const network,
+    const unsigned j, gsl_vector* const column) const
+{
+    rfn::Adjacency::Iterator oeit, oeit_end;
+    gsl_vector_set_basis(column, j);
+    const double weight = -1.0 / (double)network->out_degree(j);
+    for (boost::tie(oeit, oeit_end) = network->out_neighbours(j);
+        oeit != oeit_end; ++oeit)
+    {
+        gsl_vector_set(column, *oeit, weight);
+    }
+}
+
+/*
+ * U(:, k) = A'(:, 'sources[k]') - A(:, 'sources[k]') is stored as row 'k' of
+ * '_delta' together with the positions of its non-zero elements, i.e., the old
+ * and new targets of the source.
+ */
+void
+rfn::LowRankSolver::generate_delta(rfn::Adjacency const* const network,
+    unsigned const* const sources, const unsigned rank)
+{
+    const unsigned n = this->_parameters->nodes_total();
+    double const* column = gsl_vector_const_ptr(this->_column, 0);
+    this->_support.clear();
+    this->_offsets.clear();
+    this->_offsets.push_back(0u);
+    for (unsigned k = 0; k < rank; ++k) {
+        this->generate_column(network, sources[k], this->_column);
+        double const* old = gsl_matrix_const_ptr(this->_columns, sources[k], 0);
+        double* delta = gsl_matrix_ptr(this->_delta, k, 0);
+        for (unsigned i = 0; i < n; ++i) {
+            delta[i] = column[i] - old[i];
+            if (delta[i] != 0.0) {
+                this->_support.push_back(i);
+            }
+        }
+        this->_offsets.push_back((unsigned)this->_support.size());
+    }
+}
+
+/*
+ * W = A^-1 * U exploiting the sparsity of U.
+ */
+void
+rfn::LowRankSolver::multiply(const unsigned rank)
+{
+    const unsigned n = this->_parameters->nodes_total();
+    unsigned p = 0u;
+    double value = 0.0;
+    for (unsigned i = 0; i < n; ++i) {
+        double const* inv = gsl_matrix_const_ptr(this->_inverse, i, 0);
+        double* w = gsl_matrix_ptr(this->_w, i, 0);
+        for (unsigned k = 0; k < rank; ++k) {
+            double const* delta = gsl_matrix_const_ptr(this->_delta, k, 0);
+            value = 0.0;
+            for (p = this->_offsets[k]; p < this->_offsets[k + 1]; ++p) {
+                value += inv[this->_support[p]] * delta[this->_support[p]];
+            }
+            w[k] = value;
+        }
+    }
+}
+
+/*
+ * Overwrite the first 'cols' columns of '_rhs' with S^-1 * A^-1(C, 0:cols) by
+ * Gaussian elimination with partial pivoting, S is at most of size
+ * '_max_rank'.
+ */
+int
+rfn::LowRankSolver::solve_capacitance(unsigned const* const sources,
+    const unsigned rank, const unsigned cols)
+{
+    const size_t tda = this->_capacitance->tda;
+    double* cap = gsl_matrix_ptr(this->_capacitance, 0, 0);
+    double* row = NULL;
+    double* other = NULL;
+    unsigned a = 0u;
+    unsigned b = 0u;
+    unsigned j = 0u;
+    for (a = 0; a < rank; ++a) {
+        double const* w = gsl_matrix_const_ptr(this->_w, sources[a], 0);
+        for (b = 0; b < rank; ++b) {
+            cap[a * tda + b] = ((a == b) ? 1.0 : 0.0) + w[b];
+        }
+        double const* inv = gsl_matrix_const_ptr(this->_inverse, sources[a], 0);
+        row = gsl_matrix_ptr(this->_rhs, a, 0);
+        for (j = 0; j < cols; ++j) {
+            row[j] = inv[j];
+        }
+    }
+    unsigned pivot = 0u;
+    double factor = 0.0;
+    for (unsigned k = 0; k < rank; ++k) {
+        pivot = k;
+        for (a = k + 1; a < rank; ++a) {
+            if (std::fabs(cap[a * tda + k]) > std::fabs(cap[pivot * tda + k])) {
+                pivot = a;
+            }
+        }
+        // S is singular exactly when A' is
+        if (std::fabs(cap[pivot * tda + k]) < GSL_SQRT_DBL_EPSILON) {
+            return GSL_ESING;
+        }
+        if (pivot != k) {
+            for (b = k; b < rank; ++b) {
+                std::swap(cap[k * tda + b], cap[pivot * tda + b]);
+            }
+            row = gsl_matrix_ptr(this->_rhs, k, 0);
+            other = gsl_matrix_ptr(this->_rhs, pivot, 0);
+            for (j = 0; j < cols; ++j) {
+                std::swap(row[j], other[j]);
+            }
+        }
+        row = gsl_matrix_ptr(this->_rhs, k, 0);
+        for (a = k + 1; a < rank; ++a) {
+            factor = cap[a * tda + k] / cap[k * tda + k];
+            if (factor == 0.0) {
+                continue;
+            }
+            for (b = k + 1; b < rank; ++b) {
+                cap[a * tda + b] -= factor * cap[k * tda + b];
+            }
+            other = gsl_matrix_ptr(this->_rhs, a, 0);
+            for (j = 0; j < cols; ++j) {
+                other[j] -= factor * row[j];
+            }
+        }
+    }
+    for (unsigned k = rank; k-- > 0;) {
+        row = gsl_matrix_ptr(this->_rhs, k, 0);
+        for (b = k + 1; b < rank; ++b) {
+            other = gsl_matrix_ptr(this->_rhs, b, 0);
+            factor = cap[k * tda + b];
+            for (j = 0; j < cols; ++j) {
+                row[j] -= factor * other[j];
+            }
+        }
+        factor = 1.0 / cap[k * tda + k];
+        for (j = 0; j < cols; ++j) {
+            row[j] *= factor;
+        }
+    }
+    return GSL_SUCCESS;
+}
+
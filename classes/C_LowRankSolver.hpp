@@ -0,0 +1,128 @@
+/*******************************************************************************
+ * filename:    C_LowRankSolver.hpp
+ * description: Solves the flow distribution SLE after changes to few columns
+ * author:      agent
+ * created:     2026-10-17
+ * copyright:   Jacobs University Bremen. All rights reserved.
+ *******************************************************************************
+ * Adding or removing a link changes only the out-degree normalisation of its
+ * source, i.e., a single column of the SLE. This class keeps the inverse of the
+ * SLE of a reference network and computes the output pattern of a network that
+ * differs in the columns of a few source nodes with the Sherman-Morrison-
+ * Woodbury formula.
+ *
+ * With r changed columns of at most d non-zero elements evaluating the output
+ * pattern costs O(n * r * (d + r)) and making the changes permanent costs
+ * O(n^2 * r) instead of O(n^3) for a new factorisation.
+ ******************************************************************************/
+
+
+#ifndef _C_LOWRANKSOLVER_HPP
+#define	_C_LOWRANKSOLVER_HPP
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+
+// std
+#include <vector>
+
+// gsl
+#include <gsl/gsl_vector.h>
+
+// project
+#include "common_definitions.hpp"
+#include "C_ParameterManager.hpp"
+#include "C_ComponentSolver.hpp"
+#include "C_BinaryStream.hpp"
+
+
+/*******************************************************************************
+ * Declarations
+ ******************************************************************************/
+
+
+namespace rfn {
+
+    class LowRankSolver {
+
+    protected:
+        /* Data Members */
+        unsigned long _state;
+        unsigned _max_rank;
+        unsigned _refresh;
+        unsigned _updates;
+        bool _valid;
+        ParameterManager* _parameters;
+        // SLE of the reference network stored by columns and its inverse
+        Matrix* _columns;
+        Matrix* _inverse;
+        // workspace
+        ComponentSolver _components;
+        Matrix* _delta;
+        Matrix* _w;
+        Matrix* _capacitance;
+        Matrix* _rhs;
+        gsl_vector* _column;
+        // non-zero elements of the changed columns
+        std::vector<unsigned> _support;
+        std::vector<unsigned> _offsets;
+
+    public:
+        /* Constructors & Destructor */
+        LowRankSolver(ParameterManager* const parameters);
+        virtual ~LowRankSolver();
+
+        /* Member Functions */
+        // make 'network' the reference, returns a gsl status
+        int factorise(Adjacency const* const network);
+        // output pattern of 'network' which differs from the reference in the
+        // columns of 'sources' only, returns a gsl status
+        int evaluate(Adjacency const* const network,
+            unsigned const* const sources, const unsigned rank,
+            Matrix* const output);
+        // make 'network' the reference, knowing it differs in 'sources' only
+        int update(Adjacency const* const network,
+            unsigned const* const sources, const unsigned rank);
+        // output pattern of the reference network
+        void output(Matrix* const output) const;
+        // the reference as it has been updated, which a new factorisation
+        // would reproduce only up to rounding
+        void write_checkpoint(BinaryWriter& out) const;
+        // make the reference of a checkpoint the current one
+        void read_checkpoint(BinaryReader& in);
+        // identifies the current reference network
+        unsigned long state() const
+        {
+            return this->_state;
+        }
+        // whether the reference network has a regular SLE
+        bool valid() const
+        {
+            return this->_valid;
+        }
+        // maximum number of columns handled by a low-rank update
+        unsigned max_rank() const
+        {
+            return this->_max_rank;
+        }
+
+    protected:
+        /* Internal Functions */
+        void generate_column(Adjacency const* const network, const unsigned j,
+            gsl_vector* const column) const;
+        void generate_delta(Adjacency const* const network,
+            unsigned const* const sources, const unsigned rank);
+        void multiply(const unsigned rank);
+        int solve_capacitance(unsigned const* const sources,
+            const unsigned rank, const unsigned cols);
+
+    }; // class LowRankSolver
+
+} // namespace rfn
+
+
+#endif	// _C_LOWRANKSOLVER_HPP
+
@@ -39,7 +39,9 @@ DEFINE_BASE_SINGLETON(rfn::Mutation)
  * Default constructor
  */
 rfn::Mutation::Mutation():
-    _parameters(rfn::ParameterManager::instance())
+    _parameters(rfn::ParameterManager::instance()),
+    _sources(),
+    _changes()
 {}
 
 /*
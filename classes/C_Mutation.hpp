@@ -16,6 +16,11 @@
  ******************************************************************************/
 
 
+// std
+#include <vector>
+#include <utility>
+#include <algorithm>
+
 // project
 #include "common_definitions.hpp"
 #include "M_Singleton.hpp"
@@ -33,9 +38,17 @@ namespace rfn {
         /* Singleton Pattern Declaration */
         DECLARE_BASE_SINGLETON(Mutation)
 
+    public:
+        typedef std::pair<unsigned, unsigned> Link;
+
     protected:
         /* Data Members */
         ParameterManager* _parameters;
+        // nodes whose outgoing links were touched by the last mutation
+        std::vector<unsigned> _sources;
+        // links added or removed by the last mutation in order, i.e., undoing
+        // the mutation means flipping them in reverse order
+        std::vector<Link> _changes;
         
     public:
         /* Member Functions */
@@ -48,6 +61,43 @@ namespace rfn {
         {
             this->_parameters = p;
         }
+        // _sources get method
+        const std::vector<unsigned>& sources() const
+        {
+            return this->_sources;
+        }
+        // _changes get method
+        const std::vector<Link>& changes() const
+        {
+            return this->_changes;
+        }
+
+    protected:
+        /* Internal Functions */
+        // note a touched source node once
+        void touched(const unsigned src)
+        {
+            if (std::find(this->_sources.begin(), this->_sources.end(), src)
+                == this->_sources.end()) {
+                this->_sources.push_back(src);
+            }
+        }
+        // add a link and log it if it is new
+        void add_edge(Adjacency* const network, const unsigned src,
+            const unsigned tar)
+        {
+            if (network->add_edge(src, tar)) {
+                this->_changes.push_back(Link(src, tar));
+            }
+        }
+        // remove a link and log it if it existed
+        void remove_edge(Adjacency* const network, const unsigned src,
+            const unsigned tar)
+        {
+            if (network->remove_edge(src, tar)) {
+                this->_changes.push_back(Link(src, tar));
+            }
+        }
 
     }; // class Mutation
 
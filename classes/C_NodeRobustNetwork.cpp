@@ -14,6 +14,9 @@
  ******************************************************************************/
 
 
+// std
+#include <vector>
+
 // gsl
 #include <gsl/gsl_math.h>
 
@@ -131,41 +134,74 @@ rfn::NodeRobustNetwork::operator=(rfn::NodeRobustNetwork& a)
  ******************************************************************************/
 
 
+/*
+ * Removing a node changes its own column of the SLE and the normalisation of
+ * its predecessors' columns. The intact SLE is factorised once and every
+ * knockout is evaluated as a low-rank update on a single working copy whose
+ * links are restored afterwards, i.e., nothing is allocated in the loop.
+ */
 void
 rfn::NodeRobustNetwork::compute_robustness()
 {
-    rfn::NodeRobustNetwork* next = NULL;
     this->_robustness = 0.0;
-    // make a colour map with all nodes set to white
-    std::vector<boost::default_color_type> colours(this->num_nodes(),
-        boost::color_traits<boost::default_color_type>::white());
-    rfn::ColourMap colour_map(colours, *this->_network);
     // get all accessible nodes
-    this->accessible_nodes(colour_map);
+    std::vector<rfn::Adjacency::Word> accessible;
+    this->accessible_nodes(accessible);
     short unsigned i = 0;
+    rfn::Adjacency::Iterator ieit, ieit_end;
+    rfn::Adjacency::Iterator oeit, oeit_end;
+    rfn::NodeRobustNetwork next(*this);
+    // the knockouts happen behind the back of incremental evaluation
+    next._tracked = false;
+    rfn::LowRankSolver solver(this->_parameters);
+    solver.factorise(this->_network);
+    // changed columns and the knocked out node's targets
+    std::vector<unsigned> sources;
+    sources.reserve(this->_parameters->nodes_total());
+    std::vector<unsigned> targets;
+    targets.reserve(this->_parameters->nodes_total());
     // control middle nodes
     for (short unsigned n = this->_parameters->nodes_in();
             n < this->_parameters->nodes_end_middle(); ++n)
     {
 // reversion to initial state
 //        // only accessible nodes should be considered for robustness
-//        if (boost::get(colour_map, n) != boost::white_color) {
+//        if (rfn::Adjacency::test(&accessible[0], n)) {
             // disregard virtual sources and sinks in the middle layer
-            if (boost::in_degree(n, *this->_network) >= 1
-                    && boost::out_degree(n, *this->_network) >= 1)
+            if (this->_network->in_degree(n) >= 1
+                    && this->_network->out_degree(n) >= 1)
             {
-                next = new rfn::NodeRobustNetwork(*this);
-                boost::clear_vertex(n, *next->_network);
-                next->compute_output();
-                next->compute_flow_error();
-                if (gsl_fcmp(next->_flow_error,
+                sources.clear();
+                targets.clear();
+                sources.push_back(n);
+                for (boost::tie(ieit, ieit_end) =
+                    this->_network->in_neighbours(n); ieit != ieit_end; ++ieit)
+                {
+                    sources.push_back(*ieit);
+                }
+                for (boost::tie(oeit, oeit_end) =
+                    this->_network->out_neighbours(n); oeit != oeit_end; ++oeit)
+                {
+                    targets.push_back(*oeit);
+                }
+                next._network->clear_vertex(n);
+                next.compute_low_rank_output(&solver, &sources[0],
+                    (unsigned)sources.size());
+                next.compute_flow_error();
+                if (gsl_fcmp(next._flow_error,
                     this->_robust_parameters->robust_threshold(),
                     GSL_EPSILON) < 0)
                 {
                     this->_robustness += 1.0;
                 }
                 ++i;
-                delete next;
+                // reset the network
+                for (unsigned k = 1; k < sources.size(); ++k) {
+                    next._network->add_edge(sources[k], n);
+                }
+                for (unsigned k = 0; k < targets.size(); ++k) {
+                    next._network->add_edge(n, targets[k]);
+                }
             }
 //        }
     }
@@ -14,11 +14,18 @@
  ******************************************************************************/
 
 
+// std
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
 // gsl
 #include <gsl/gsl_math.h>
+#include <gsl/gsl_cdf.h>
 
 // project
 #include "C_NoiseRobustNetwork.hpp"
+#include "C_Profile.hpp"
 
 
 /*******************************************************************************
@@ -31,15 +38,11 @@
  */
 rfn::NoiseRobustNetwork::NoiseRobustNetwork():
     rfn::RobustFunctionalNetwork(),
-    _val_dist(NULL),
-    _val_gen(NULL),
-    _noise_parameters(NULL)
+    _noise_parameters(NULL),
+    _keyed(false),
+    _key(0u),
+    _hits()
 {
-    // tie rng to get a number between 0 and 1
-    this->_val_dist = new Real;
-    CHECK_CRITICAL_POINTER(this->_val_dist);
-    this->_val_gen = new RealNumber(this->_parameters->rng(), *this->_val_dist);
-    CHECK_CRITICAL_POINTER(this->_val_gen);
     this->_noise_parameters = static_cast<NoiseRobustParameterManager*>
         (this->_parameters);
 }
@@ -50,27 +53,17 @@ rfn::NoiseRobustNetwork::NoiseRobustNetwork():
 rfn::NoiseRobustNetwork::NoiseRobustNetwork(
     const rfn::NoiseRobustNetwork& c):
     rfn::RobustFunctionalNetwork(c),
-    _val_dist(NULL),
-    _val_gen(NULL),
-    _noise_parameters(c._noise_parameters)
-{
-    // tie rng to get a number between 0 and 1
-    // don't want to copy state of the random number generator
-    this->_val_dist = new Real;
-    CHECK_CRITICAL_POINTER(this->_val_dist);
-    this->_val_gen = new RealNumber(this->_parameters->rng(), *this->_val_dist);
-    CHECK_CRITICAL_POINTER(this->_val_gen);
-}
+    _noise_parameters(c._noise_parameters),
+    _keyed(false),
+    _key(0u),
+    _hits()
+{}
 
 /*
  * Destructor
  */
 rfn::NoiseRobustNetwork::~NoiseRobustNetwork()
 {
-    delete this->_val_gen;
-    this->_val_gen = NULL;
-    delete this->_val_dist;
-    this->_val_dist = NULL;
     this->_noise_parameters = NULL; // singleton destructs itself
 }
 
@@ -159,6 +152,101 @@ rfn::NoiseRobustNetwork::operator=(rfn::NoiseRobustNetwork& a)
 }
 
 
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+
+
+/*
+ * A key prepared for a previous candidate does not carry over.
+ */
+void
+rfn::NoiseRobustNetwork::copy(const rfn::FlowDistributionNetwork& c)
+{
+    if (this != &c) {
+        rfn::RobustFunctionalNetwork::copy(c);
+        const NoiseRobustNetwork& other = static_cast
+            <const NoiseRobustNetwork&>(c);
+        this->_noise_parameters = other._noise_parameters;
+        this->_keyed = false;
+    }
+}
+
+/*
+ * Realisations are sampled in batches of 'nodes_middle()'. After each batch the
+ * mutated network is rejected if even the remaining realisations could not lift
+ * it above 'bound' or if the upper Wilson score bound of its robustness at the
+ * requested confidence lies below 'bound'. Only networks that are accepted
+ * complete the full sample and thus know their robustness.
+ */
+bool
+rfn::NoiseRobustNetwork::robustness_exceeds(const double bound)
+{
+    if (!this->_robust_changed || gsl_fcmp(this->_flow_error,
+        this->_robust_parameters->robust_threshold(), GSL_EPSILON) >= 0)
+    {
+        return rfn::RobustFunctionalNetwork::robustness_exceeds(bound);
+    }
+    const unsigned batch = this->_parameters->nodes_middle();
+    const unsigned num_realisations = 10 * batch;
+    const double z = gsl_cdf_ugaussian_Pinv(
+        this->_robust_parameters->confidence());
+    const double z2 = z * z;
+    const boost::uint32_t key = this->draw_key();
+    rfn::Profile::Scope scope(rfn::Profile::robustness);
+    std::vector<rfn::FlowDistributionNetwork*>& workers = this->workers();
+    unsigned hits = 0u;
+    double p = 0.0;
+    double upper = 0.0;
+    for (unsigned n = batch; n <= num_realisations; n += batch) {
+        hits += this->sample(workers, n - batch, n, key);
+        if (n == num_realisations) {
+            break;
+        }
+        // largest robustness still attainable
+        if (gsl_fcmp((double)(hits + num_realisations - n) /
+            (double)num_realisations, bound, GSL_EPSILON) <= 0)
+        {
+            return false;
+        }
+        p = (double)hits / (double)n;
+        upper = (p + z2 / (2.0 * n) + z * std::sqrt(p * (1.0 - p) / n
+            + z2 / (4.0 * n * n))) / (1.0 + z2 / n);
+        if (upper < bound) {
+            return false;
+        }
+    }
+    this->_robustness = (double)hits / (double)num_realisations;
+    this->_robust_changed = false;
+    return gsl_fcmp(this->_robustness, bound, GSL_EPSILON) > 0;
+}
+
+
+void
+rfn::NoiseRobustNetwork::write_checkpoint(rfn::BinaryWriter& out,
+    const unsigned long iteration)
+{
+    rfn::RobustFunctionalNetwork::write_checkpoint(out, iteration);
+    out.put_u16(this->_keyed);
+    out.put_u32(this->_key);
+}
+
+void
+rfn::NoiseRobustNetwork::read_checkpoint(rfn::BinaryReader& in)
+{
+    rfn::RobustFunctionalNetwork::read_checkpoint(in);
+    this->_keyed = (in.get_u16() != 0u);
+    this->_key = in.get_u32();
+}
+
+void
+rfn::NoiseRobustNetwork::prepare_robustness()
+{
+    this->_key = this->draw_key();
+    this->_keyed = true;
+}
+
+
 /*******************************************************************************
  * Internal Functions
  ******************************************************************************/
@@ -167,41 +255,103 @@ rfn::NoiseRobustNetwork::operator=(rfn::NoiseRobustNetwork& a)
 void
 rfn::NoiseRobustNetwork::compute_robustness()
 {
-    rfn::NoiseRobustNetwork next(*this);
-    this->_robustness = 0.0;
-    Matrix* sle = gsl_matrix_calloc(this->_parameters->nodes_total(),
-        this->_parameters->nodes_total());
-    CHECK_CRITICAL_GSL_POINTER(sle, __FILE__, __LINE__);
-    Matrix* weights = gsl_matrix_calloc(this->_parameters->nodes_total(),
-        this->_parameters->nodes_total());
-    CHECK_CRITICAL_GSL_POINTER(weights, __FILE__, __LINE__);
     const unsigned num_realisations = 10 * this->_parameters->nodes_middle();
-    for (unsigned n = 0; n < num_realisations; ++n)
-    {
-        next.generate_noise_sle(sle, weights);
-        next.generate_output(sle);
-        next.compute_flow_error();
-        if (gsl_fcmp(next._flow_error,
+    const boost::uint32_t key = this->draw_key();
+    // robustness is a fraction of all nodes applicable
+    this->_robustness = (double)this->sample(this->workers(), 0u,
+        num_realisations, key) / (double)num_realisations;
+}
+
+/*
+ * The key is the only draw from the global generator per robustness
+ * computation.
+ */
+boost::uint32_t
+rfn::NoiseRobustNetwork::draw_key()
+{
+    if (this->_keyed) {
+        this->_keyed = false;
+        return this->_key;
+    }
+    return (boost::uint32_t)(this->_parameters->rng()() * 4294967296.0);
+}
+
+/*
+ * Every share of the pool evaluates its realisations on its own copy of the
+ * network, the copies only take over the current state.
+ */
+std::vector<rfn::FlowDistributionNetwork*>&
+rfn::NoiseRobustNetwork::workers()
+{
+    return this->workspace()->workers(this,
+        this->_parameters->realisation_threads());
+}
+
+/*
+ * Hits are counted per share and summed up afterwards so that the result is
+ * independent of the scheduling.
+ */
+unsigned
+rfn::NoiseRobustNetwork::sample(
+    std::vector<rfn::FlowDistributionNetwork*>& workers, const unsigned first,
+    const unsigned last, const boost::uint32_t key)
+{
+    rfn::ThreadPool* const pool = this->workspace()->pool(
+        this->_parameters->realisation_threads());
+    this->_hits.assign(pool->count(), 0u);
+    Sample job(workers, first, last, key, this->_hits);
+    pool->run(job);
+    unsigned total = 0u;
+    for (unsigned t = 0; t < this->_hits.size(); ++t) {
+        total += this->_hits[t];
+    }
+    return total;
+}
+
+void
+rfn::NoiseRobustNetwork::Sample::share(const unsigned index,
+    const unsigned count)
+{
+    static_cast<rfn::NoiseRobustNetwork*>(this->_workers[index])->realise(
+        this->_first + index, this->_last, count, this->_key,
+        &this->_hits[index]);
+}
+
+/*
+ * The stream of realisation 'r' is seeded by a multiplicative hash of 'r'
+ * added to 'key'.
+ */
+void
+rfn::NoiseRobustNetwork::realise(const unsigned first, const unsigned last,
+    const unsigned step, const boost::uint32_t key, unsigned* const hits)
+{
+    Matrix* const sle = this->workspace()->noise();
+    Matrix* const weights = this->workspace()->weights();
+    rfn::RandGen stream;
+    Real dist;
+    RealNumber values(stream, dist);
+    for (unsigned r = first; r < last; r += step) {
+        stream.seed((boost::uint32_t)(key + r * 2654435761u));
+        this->generate_noise_sle(sle, weights, values);
+        this->generate_output(sle);
+        this->compute_flow_error();
+        if (gsl_fcmp(this->_flow_error,
             this->_robust_parameters->robust_threshold(), GSL_EPSILON) < 0)
         {
-            this->_robustness += 1.0;
+            ++(*hits);
         }
     }
-    // robustness is a fraction of all nodes applicable
-    this->_robustness /= (double)num_realisations;
-    gsl_matrix_free(sle);
-    gsl_matrix_free(weights);
 }
 
 void
 rfn::NoiseRobustNetwork::generate_noise_sle(rfn::Matrix* const sle,
-    rfn::Matrix* const weights)
+    rfn::Matrix* const weights, RealNumber& values)
 {
+    rfn::Profile::Scope scope(rfn::Profile::build);
     // matrix orientations are: link from j to i is recorded at element ij
     gsl_matrix_set_zero(weights);
     short unsigned i = 0;
     short unsigned j = 0;
-    boost::graph_traits<rfn::Adjacency>::edge_descriptor edge;
     for (j = 0; j < this->_parameters->nodes_end_middle(); ++j) {
         for (i = this->_parameters->nodes_in();
             i < this->_parameters->nodes_total(); ++i)
@@ -214,19 +364,19 @@ rfn::NoiseRobustNetwork::generate_noise_sle(rfn::Matrix* const sle,
                 && this->_parameters->is_middle(i))
             {
                 // input nodes can only leak to middle nodes
-                this->set_noise(weights, i, j, edge);
+                this->set_noise(weights, i, j, values);
             }
             else if (this->_parameters->is_middle(j)
                 && this->_parameters->is_middle(i))
             {
                 // outgoing links between middle nodes themselves
-                this->set_noise(weights, i, j, edge);
+                this->set_noise(weights, i, j, values);
             }
             else if (this->_parameters->is_middle(j)
                 && this->_parameters->is_output(i))
             {
                 // links from middle nodes to output nodes
-                this->set_noise(weights, i, j, edge);
+                this->set_noise(weights, i, j, values);
             }
         }
     }
@@ -249,22 +399,19 @@ rfn::NoiseRobustNetwork::generate_noise_sle(rfn::Matrix* const sle,
 
 void
 rfn::NoiseRobustNetwork::set_noise(rfn::Matrix* const weights,
-    const short unsigned i, const short unsigned j,
-    boost::graph_traits<rfn::Adjacency>::edge_descriptor& edge)
+    const short unsigned i, const short unsigned j, RealNumber& values)
 {
-    bool found;
-    boost::tie(edge, found) = boost::edge(j, i, *this->_network);
-    if (found) {
+    if (this->_network->edge(j, i)) {
         // flow on existing links is slightly reduced
         gsl_matrix_set(weights, i, j, 1.0 -
             this->_noise_parameters->noise_level()
-            * (*this->_val_gen)());
+            * values());
     }
     else {
         // a small leakage flow goes over inexistant links
         gsl_matrix_set(weights, i, j,
             this->_noise_parameters->noise_level()
-            * (*this->_val_gen)());
+            * values());
     }
 }
 
@@ -5,7 +5,21 @@
  * created:     2010-07-21
  * copyright:   Jacobs University Bremen. All rights reserved.
  *******************************************************************************
+ * The noise realisations of a robustness computation are spread over
+ * 'realisation_threads()' copies of the network, the share of 'threads()' left
+ * by the evaluation of several candidates. The copies, their noise buffers
+ * and the pool of threads they run in are kept in the workspace of the
+ * network from one computation to the next. Realisation 'r' draws its noise
+ * from a random number stream seeded by a key taken from the global generator
+ * and 'r' alone, thus the robustness does not depend on the number of
+ * threads.
  *
+ * With a non-zero 'confidence()' the realisations are sampled in batches and a
+ * mutated network is rejected as soon as the upper Wilson score bound of its
+ * robustness falls below the acceptance bound. The bound is checked after
+ * each of the first nine of ten batches at the full confidence, without
+ * correction for the repeated looks, thus a good mutation is wrongly rejected
+ * more often than the requested confidence suggests.
  ******************************************************************************/
 
 
@@ -18,13 +32,18 @@
  ******************************************************************************/
 
 
+// std
+#include <vector>
+
 // boost
+#include <boost/cstdint.hpp>
 #include <boost/random/uniform_real.hpp>
 #include <boost/random/variate_generator.hpp>
 
 // project
 #include "C_RobustFunctionalNetwork.hpp"
 #include "C_NoiseRobustParameterManager.hpp"
+#include "C_ThreadPool.hpp"
 
 
 /*******************************************************************************
@@ -40,10 +59,35 @@ namespace rfn {
         /* Data Members */
         typedef boost::uniform_real<double> Real;
         typedef boost::variate_generator<rfn::RandGen&, Real> RealNumber;
-        Real* _val_dist;
-        RealNumber* _val_gen;
         NoiseRobustParameterManager* _noise_parameters;
-        
+        // key of the noise streams drawn in advance
+        bool _keyed;
+        boost::uint32_t _key;
+        // realisations below the threshold per share of a sample
+        std::vector<unsigned> _hits;
+
+        // realisations from 'first' to 'last' shared out among the copies
+        class Sample: public ThreadPool::Job {
+        protected:
+            std::vector<FlowDistributionNetwork*>& _workers;
+            const unsigned _first;
+            const unsigned _last;
+            const boost::uint32_t _key;
+            std::vector<unsigned>& _hits;
+
+        public:
+            Sample(std::vector<FlowDistributionNetwork*>& workers,
+                const unsigned first, const unsigned last,
+                const boost::uint32_t key, std::vector<unsigned>& hits):
+                _workers(workers),
+                _first(first),
+                _last(last),
+                _key(key),
+                _hits(hits)
+            {}
+            virtual void share(const unsigned index, const unsigned count);
+        };
+
     public:
         /* Constructors & Destructor */
         NoiseRobustNetwork();
@@ -61,13 +105,33 @@ namespace rfn {
         NoiseRobustNetwork& operator=(const NoiseRobustNetwork& a);
         NoiseRobustNetwork& operator=(NoiseRobustNetwork& a);
 
+        /* Member Functions */
+        virtual void copy(const FlowDistributionNetwork& c);
+        virtual bool robustness_exceeds(const double bound);
+        virtual void prepare_robustness();
+        virtual void write_checkpoint(BinaryWriter& out,
+            const unsigned long iteration);
+        virtual void read_checkpoint(BinaryReader& in);
+
     protected:
         /* Internal Functions */
         virtual void compute_robustness();
-        void generate_noise_sle(Matrix* const sle, Matrix* const weights);
+        // key of the noise streams of one robustness computation
+        boost::uint32_t draw_key();
+        // copies of this network, one per share of the pool
+        std::vector<FlowDistributionNetwork*>& workers();
+        // number of realisations from 'first' to 'last' below the threshold
+        unsigned sample(std::vector<FlowDistributionNetwork*>& workers,
+            const unsigned first, const unsigned last,
+            const boost::uint32_t key);
+        // evaluate every 'step'th realisation from 'first' to 'last'
+        void realise(const unsigned first, const unsigned last,
+            const unsigned step, const boost::uint32_t key,
+            unsigned* const hits);
+        void generate_noise_sle(Matrix* const sle, Matrix* const weights,
+            RealNumber& values);
         void set_noise(Matrix* const weights, const short unsigned i,
-            const short unsigned j,
-            boost::graph_traits<rfn::Adjacency>::edge_descriptor& edge);
+            const short unsigned j, RealNumber& values);
         double sum(const gsl_vector* const outgoing_weights) const;
 
     }; // class NoiseRobustNetwork
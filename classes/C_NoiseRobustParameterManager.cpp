@@ -44,15 +44,27 @@ rfn::NoiseRobustParameterManager::~NoiseRobustParameterManager()
 
 
 void
-rfn::NoiseRobustParameterManager::write_to_binary_stream(bfsys::ofstream& out)
+rfn::NoiseRobustParameterManager::write_to_binary_stream(
+    rfn::BinaryWriter& out)
 {
     rfn::RobustParameterManager::write_to_binary_stream(out);
-    out.write((char*)&this->_noise_level, sizeof(double));
+    out.put_f64(this->_noise_level);
 }
 
 void
-rfn::NoiseRobustParameterManager::read_from_binary_stream(bfsys::ifstream& in)
+rfn::NoiseRobustParameterManager::read_from_binary_stream(
+    rfn::BinaryReader& in)
 {
     rfn::RobustParameterManager::read_from_binary_stream(in);
-    in.read((char*)&this->_noise_level, sizeof(double));
+    this->_noise_level = in.get_f64();
 }
+
+void
+rfn::NoiseRobustParameterManager::assign(
+    rfn::ParameterManager const* const other)
+{
+    rfn::RobustParameterManager::assign(other);
+    this->_noise_level = static_cast<rfn::NoiseRobustParameterManager const*>
+        (other)->_noise_level;
+}
+
@@ -43,9 +43,11 @@ namespace rfn {
     public:
         /* Member Functions */
         // save this object to a binary stream
-        virtual void write_to_binary_stream(bfsys::ofstream& out);
+        virtual void write_to_binary_stream(BinaryWriter& out);
         // load this object from a binary stream
-        virtual void read_from_binary_stream(bfsys::ifstream& in);
+        virtual void read_from_binary_stream(BinaryReader& in);
+        // take over all parameters of another instance of the same type
+        virtual void assign(ParameterManager const* const other);
         // _noise_level get method
         double noise_level() const
         {
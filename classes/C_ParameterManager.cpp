@@ -22,14 +22,6 @@
 #include "rfn_config.hpp"
 
 
-/*******************************************************************************
- * Static Variable Initialisation
- ******************************************************************************/
-
-
-rfn::RandGen rfn::ParameterManager::_rng;
-
-
 /*******************************************************************************
  * Necessary Singleton Pattern Definitions
  ******************************************************************************/
@@ -65,7 +57,25 @@ rfn::ParameterManager::ParameterManager():
     _network_type(rfn::flow_evolved),
     _network_init(rfn::random),
     _pattern_init(rfn::random_k),
-    _mutation_type(rfn::path_mutation)
+    _mutation_type(rfn::path_mutation),
+    _solver_type(rfn::dense_lu),
+    _backend(rfn::gsl_backend),
+    _incremental(false),
+    _early_exit(false),
+    _profile(false),
+    _telemetry(""),
+    _telemetry_interval(1000u),
+    _archive(""),
+    _checkpoint_interval(0u),
+    _resume(false),
+    _threads(1u),
+    _jobs(1u),
+    _temperatures(1u),
+    _temperature_ratio(2.0),
+    _swap_interval(100u),
+    _candidates(1u),
+    _selection(rfn::best_candidate),
+    _rng()
 {}
 
 /*
@@ -117,53 +127,95 @@ rfn::ParameterManager::instance(const rfn::FunctionalNetworkScheme scheme)
 }
 
 void
-rfn::ParameterManager::write_to_binary_stream(bfsys::ofstream& out)
+rfn::ParameterManager::write_to_binary_stream(rfn::BinaryWriter& out)
+{
+    out.put_u16(RFN5_VERSION_MAJOR);
+    out.put_u16(this->_nodes_in);
+    out.put_u16(this->_nodes_middle);
+    out.put_u16(this->_nodes_out);
+    out.put_u16(this->_activated_k);
+    out.put_f64(this->_error_threshold);
+    out.put_f64(this->_annealing_factor);
+    out.put_u64(this->_max_time);
+    out.put_u16(this->_snapshots);
+    out.put_f64(this->_connectivity);
+    out.put_f64(this->_add_mutation);
+    out.put_u16(this->_network_type);
+    out.put_u16(this->_network_init);
+    out.put_u16(this->_pattern_init);
+    out.put_u16(this->_mutation_type);
+}
+
+/*
+ * Legacy files hold a second copy of the error threshold in place of the
+ * maximum time, which is therefore not restored from them.
+ */
+void
+rfn::ParameterManager::read_from_binary_stream(rfn::BinaryReader& in)
 {
-    short unsigned version = RFN5_VERSION_MAJOR;
-    out.write((char*)&version, sizeof(short unsigned));
-    out.write((char*)&this->_nodes_in, sizeof(short unsigned));
-    out.write((char*)&this->_nodes_middle, sizeof(short unsigned));
-    out.write((char*)&this->_nodes_out, sizeof(short unsigned));
-    out.write((char*)&this->_activated_k, sizeof(short unsigned));
-    out.write((char*)&this->_error_threshold, sizeof(double));
-    out.write((char*)&this->_annealing_factor, sizeof(double));
-    out.write((char*)&this->_error_threshold, sizeof(unsigned long));
-    out.write((char*)&this->_snapshots, sizeof(short unsigned));
-    out.write((char*)&this->_connectivity, sizeof(double));
-    out.write((char*)&this->_add_mutation, sizeof(double));
-    version = this->_network_type;
-    out.write((char*)&version, sizeof(short unsigned));
-    version = this->_network_init;
-    out.write((char*)&version, sizeof(short unsigned));
-    version = this->_pattern_init;
-    out.write((char*)&version, sizeof(short unsigned));
-    version = this->_mutation_type;
-    out.write((char*)&version, sizeof(short unsigned));
+    // major version of the program
+    in.get_u16();
+    this->_nodes_in = in.get_u16();
+    this->_nodes_middle = in.get_u16();
+    this->_nodes_out = in.get_u16();
+    this->_activated_k = in.get_u16();
+    this->_error_threshold = in.get_f64();
+    this->_annealing_factor = in.get_f64();
+    const boost::uint64_t max_time = in.get_u64();
+    if (!in.legacy()) {
+        this->_max_time = max_time;
+    }
+    this->_snapshots = in.get_u16();
+    this->_connectivity = in.get_f64();
+    this->_add_mutation = in.get_f64();
+    // the schemes are fixed when the instance is created
+    for (unsigned k = 0; k < 4; ++k) {
+        in.get_u16();
+    }
 }
 
+/*
+ * The random number generator is seeded anew rather than copied.
+ */
 void
-rfn::ParameterManager::read_from_binary_stream(bfsys::ifstream& in)
+rfn::ParameterManager::assign(rfn::ParameterManager const* const other)
 {
-    short unsigned version = 0u;
-    in.read((char*)&version, sizeof(short unsigned));
-    in.read((char*)&this->_nodes_in, sizeof(short unsigned));
-    in.read((char*)&this->_nodes_middle, sizeof(short unsigned));
-    in.read((char*)&this->_nodes_out, sizeof(short unsigned));
-    in.read((char*)&this->_activated_k, sizeof(short unsigned));
-    in.read((char*)&this->_error_threshold, sizeof(double));
-    in.read((char*)&this->_annealing_factor, sizeof(double));
-    in.read((char*)&this->_error_threshold, sizeof(unsigned long));
-    in.read((char*)&this->_snapshots, sizeof(short unsigned));
-    in.read((char*)&this->_connectivity, sizeof(double));
-    in.read((char*)&this->_add_mutation, sizeof(double));
-//    in.read((char*)&version, sizeof(short unsigned));
-//    this->_network_type = this->find_network_type(version);
-//    in.read((char*)&version, sizeof(short unsigned));
-//    this->_network_init = this->find_network_init(version);
-//    in.read((char*)&version, sizeof(short unsigned));
-//    this->_pattern_init = this->find_pattern_init(version);
-//    in.read((char*)&version, sizeof(short unsigned));
-//    this->_mutation_type = this->find_mutation_type(version);
+    this->seed(other->_seed);
+    this->_nodes_in = other->_nodes_in;
+    this->_nodes_middle = other->_nodes_middle;
+    this->_nodes_out = other->_nodes_out;
+    this->_nodes_end_middle = other->_nodes_end_middle;
+    this->_nodes_total = other->_nodes_total;
+    this->_activated_k = other->_activated_k;
+    this->_error_threshold = other->_error_threshold;
+    this->_annealing_factor = other->_annealing_factor;
+    this->_max_time = other->_max_time;
+    this->_snapshots = other->_snapshots;
+    this->_connectivity = other->_connectivity;
+    this->_add_mutation = other->_add_mutation;
+    this->_lower_bound = other->_lower_bound;
+    this->_upper_bound = other->_upper_bound;
+    this->_network_type = other->_network_type;
+    this->_network_init = other->_network_init;
+    this->_pattern_init = other->_pattern_init;
+    this->_mutation_type = other->_mutation_type;
+    this->_solver_type = other->_solver_type;
+    this->_backend = other->_backend;
+    this->_incremental = other->_incremental;
+    this->_early_exit = other->_early_exit;
+    this->_profile = other->_profile;
+    this->_telemetry = other->_telemetry;
+    this->_telemetry_interval = other->_telemetry_interval;
+    this->_archive = other->_archive;
+    this->_checkpoint_interval = other->_checkpoint_interval;
+    this->_resume = other->_resume;
+    this->_threads = other->_threads;
+    this->_jobs = other->_jobs;
+    this->_temperatures = other->_temperatures;
+    this->_temperature_ratio = other->_temperature_ratio;
+    this->_swap_interval = other->_swap_interval;
+    this->_candidates = other->_candidates;
+    this->_selection = other->_selection;
 }
 
 bool
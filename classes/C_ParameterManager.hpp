@@ -18,6 +18,7 @@
 
 // std
 #include <string>
+#include <algorithm>
 
 // boost
 #include <boost/filesystem/fstream.hpp>
@@ -29,6 +30,7 @@
 #include "common_definitions.hpp"
 #include "M_Singleton.hpp"
 #include "C_NetworkInitialiser.hpp"
+#include "C_BinaryStream.hpp"
 
 
 /*******************************************************************************
@@ -63,16 +65,35 @@ namespace rfn {
         NetworkInitScheme _network_init;
         PatternInitScheme _pattern_init;
         MutationScheme _mutation_type;
-        static RandGen _rng;
+        SolverScheme _solver_type;
+        BackendScheme _backend;
+        bool _incremental;
+        bool _early_exit;
+        bool _profile;
+        std::string _telemetry;
+        unsigned _telemetry_interval;
+        std::string _archive;
+        unsigned _checkpoint_interval;
+        bool _resume;
+        unsigned _threads;
+        unsigned _jobs;
+        unsigned _temperatures;
+        double _temperature_ratio;
+        unsigned _swap_interval;
+        unsigned _candidates;
+        SelectionScheme _selection;
+        RandGen _rng;
 
     public:
         /* Member Functions */
         // _instance retrieval method
         static ParameterManager* instance(const FunctionalNetworkScheme scheme);
         // save this object to a binary stream
-        virtual void write_to_binary_stream(bfsys::ofstream& out);
+        virtual void write_to_binary_stream(BinaryWriter& out);
         // load this object from a binary stream
-        virtual void read_from_binary_stream(bfsys::ifstream& in);
+        virtual void read_from_binary_stream(BinaryReader& in);
+        // take over all parameters of another instance of the same type
+        virtual void assign(ParameterManager const* const other);
         // ascertain legal network structure
         bool regards_structure(const short unsigned src,
             const short unsigned tar) const;
@@ -85,7 +106,7 @@ namespace rfn {
         void seed(const unsigned s)
         {
             this->_seed = s;
-            ParameterManager::_rng.seed(s);
+            this->_rng.seed(s);
         }
         // _nodes_in get method
         short unsigned nodes_in() const
@@ -223,9 +244,9 @@ namespace rfn {
             this->_upper_bound = b;
         }
         // random number generator retrieval
-        static RandGen& rng()
+        RandGen& rng()
         {
-            return ParameterManager::_rng;
+            return this->_rng;
         }
         // _network_type get method
         FunctionalNetworkScheme network_type() const
@@ -267,6 +288,188 @@ namespace rfn {
         {
             this->_mutation_type = s;
         }
+        // _solver_type get method
+        SolverScheme solver_type() const
+        {
+            return this->_solver_type;
+        }
+        // _solver_type set method
+        void solver_type(const SolverScheme s)
+        {
+            this->_solver_type = s;
+        }
+        // _backend get method
+        BackendScheme backend() const
+        {
+            return this->_backend;
+        }
+        // _backend set method
+        void backend(const BackendScheme b)
+        {
+            this->_backend = b;
+        }
+        // _incremental get method
+        bool incremental() const
+        {
+            return this->_incremental;
+        }
+        // _incremental set method
+        void incremental(const bool b)
+        {
+            this->_incremental = b;
+        }
+        // _early_exit get method
+        bool early_exit() const
+        {
+            return this->_early_exit;
+        }
+        // _early_exit set method
+        void early_exit(const bool b)
+        {
+            this->_early_exit = b;
+        }
+        // _profile get method
+        bool profile() const
+        {
+            return this->_profile;
+        }
+        // _profile set method
+        void profile(const bool b)
+        {
+            this->_profile = b;
+        }
+        // _telemetry get method
+        const std::string& telemetry() const
+        {
+            return this->_telemetry;
+        }
+        // _telemetry set method
+        void telemetry(const std::string& path)
+        {
+            this->_telemetry = path;
+        }
+        // _telemetry_interval get method
+        unsigned telemetry_interval() const
+        {
+            return this->_telemetry_interval;
+        }
+        // _telemetry_interval set method
+        void telemetry_interval(const unsigned n)
+        {
+            this->_telemetry_interval = n;
+        }
+        // _archive get method
+        const std::string& archive() const
+        {
+            return this->_archive;
+        }
+        // _archive set method
+        void archive(const std::string& path)
+        {
+            this->_archive = path;
+        }
+        // _checkpoint_interval get method, 0 if there are no checkpoints
+        unsigned checkpoint_interval() const
+        {
+            return this->_checkpoint_interval;
+        }
+        // _checkpoint_interval set method
+        void checkpoint_interval(const unsigned n)
+        {
+            this->_checkpoint_interval = n;
+        }
+        // _resume get method
+        bool resume() const
+        {
+            return this->_resume;
+        }
+        // _resume set method
+        void resume(const bool b)
+        {
+            this->_resume = b;
+        }
+        // _threads get method
+        unsigned threads() const
+        {
+            return this->_threads;
+        }
+        // _threads set method
+        void threads(const unsigned n)
+        {
+            this->_threads = n;
+        }
+        // _jobs get method
+        unsigned jobs() const
+        {
+            return this->_jobs;
+        }
+        // _jobs set method
+        void jobs(const unsigned n)
+        {
+            this->_jobs = n;
+        }
+        // _temperatures get method
+        unsigned temperatures() const
+        {
+            return this->_temperatures;
+        }
+        // _temperatures set method
+        void temperatures(const unsigned n)
+        {
+            this->_temperatures = n;
+        }
+        // _temperature_ratio get method
+        double temperature_ratio() const
+        {
+            return this->_temperature_ratio;
+        }
+        // _temperature_ratio set method
+        void temperature_ratio(const double r)
+        {
+            this->_temperature_ratio = r;
+        }
+        // _swap_interval get method
+        unsigned swap_interval() const
+        {
+            return this->_swap_interval;
+        }
+        // _swap_interval set method
+        void swap_interval(const unsigned n)
+        {
+            this->_swap_interval = n;
+        }
+        // _candidates get method
+        unsigned candidates() const
+        {
+            return this->_candidates;
+        }
+        // _candidates set method
+        void candidates(const unsigned n)
+        {
+            this->_candidates = n;
+        }
+        // threads evaluating the candidates of a step, the share of
+        // '_threads' they take
+        unsigned candidate_threads() const
+        {
+            return std::max(1u, std::min(this->_threads, this->_candidates));
+        }
+        // threads evaluating the noise realisations of a network, the share of
+        // '_threads' left to each candidate
+        unsigned realisation_threads() const
+        {
+            return std::max(1u, this->_threads / this->candidate_threads());
+        }
+        // _selection get method
+        SelectionScheme selection() const
+        {
+            return this->_selection;
+        }
+        // _selection set method
+        void selection(const SelectionScheme s)
+        {
+            this->_selection = s;
+        }
         // check whether a node belongs to the input layer
         bool is_input(const short unsigned n) const
         {
@@ -117,6 +117,8 @@ rfn::PathMutation::mutate(rfn::Adjacency* const network)
     short unsigned end = (*this->_out_gen)();
     short unsigned src = (*this->_in_gen)();
     short unsigned tar = 0;
+    this->_sources.clear();
+    this->_changes.clear();
     if ((*this->_bool_gen)()) {
         // we add a path
         for (short unsigned i = 0; i < length; ++i) {
@@ -124,10 +126,12 @@ rfn::PathMutation::mutate(rfn::Adjacency* const network)
             do {
                 tar = (*this->_mid_gen)();
             } while (src == tar);
-            boost::add_edge(src, tar, *network);
+            this->add_edge(network, src, tar);
+            this->touched(src);
             src = tar;
         }
-        boost::add_edge(src, end, *network);
+        this->add_edge(network, src, end);
+        this->touched(src);
     }
     else {
         // we remove a path
@@ -136,10 +140,12 @@ rfn::PathMutation::mutate(rfn::Adjacency* const network)
             do {
                 tar = (*this->_mid_gen)();
             } while (src == tar);
-            boost::remove_edge(src, tar, *network);
+            this->remove_edge(network, src, tar);
+            this->touched(src);
             src = tar;
         }
-        boost::remove_edge(src, end, *network);
+        this->remove_edge(network, src, end);
+        this->touched(src);
     }
 }
 
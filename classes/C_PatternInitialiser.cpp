@@ -19,10 +19,11 @@
 #include <cstdlib>
 
 // gsl
-#include <gsl/gsl_blas.h>
+#include <gsl/gsl_matrix.h>
 
 // project
 #include "C_PatternInitialiser.hpp"
+#include "C_LinearAlgebra.hpp"
 #include "C_RandomPatternInitialiser.hpp"
 #include "C_ComplexityPatternInitialiser.hpp"
 #include "C_HighComplexityPatternInitialiser.hpp"
@@ -124,21 +125,9 @@ double
 rfn::PatternInitialiser::complexity(
     rfn::ParameterManager* const parameters, rfn::Matrix* const pattern)
 {
-    int status = 0;
-    double sum = 0.0;
-    double tmp = 0.0;
-    gsl_vector_view one;
-    gsl_vector_view other;
-    for (unsigned first = 0u; first < (parameters->nodes_in() - 1u); ++first) {
-        for (unsigned second = first + 1; second < parameters->nodes_in();
-            ++second)
-        {
-            one = gsl_matrix_column(pattern, first);
-            other = gsl_matrix_column(pattern, second);
-            status = gsl_blas_ddot (&one.vector, &other.vector, &tmp);
-            CHECK_CRITICAL_GSL_STATUS(status, __FILE__, __LINE__);
-            sum += tmp;
-        }
-    }
-    return sum;
+    // a pattern has 'nodes_in()' columns
+    gsl_matrix_view columns = gsl_matrix_submatrix(pattern, 0, 0,
+        pattern->size1, parameters->nodes_in());
+    return rfn::LinearAlgebra::backend(parameters->backend())->complexity(
+        &columns.matrix);
 }
@@ -0,0 +1,287 @@
+/*******************************************************************************
+ * filename:    C_PatternKernels.cpp
+ * description: Implementation of 'PatternKernels' class
+ * author:      agent
+ * created:     2026-10-17
+ * copyright:   Jacobs University Bremen. All rights reserved.
+ ******************************************************************************/
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+
+// std
+#include <cassert>
+
+// project
+#include "C_PatternKernels.hpp"
+
+#ifdef RFN_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+
+/*******************************************************************************
+ * Static Data Members
+ ******************************************************************************/
+
+
+const rfn::PatternKernels::Table rfn::PatternKernels::_table =
+    rfn::PatternKernels::select();
+
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+
+
+double
+rfn::PatternKernels::squared_error(const rfn::Matrix* const a,
+    const rfn::Matrix* const b)
+{
+    assert(a->size1 == b->size1 && a->size2 == b->size2);
+    if (a->tda == a->size2 && b->tda == b->size2) {
+        return _table.squared_error(a->data, b->data, a->size1 * a->size2);
+    }
+    double sum = 0.0;
+    for (size_t i = 0; i < a->size1; ++i) {
+        sum += _table.squared_error(a->data + i * a->tda,
+            b->data + i * b->tda, a->size2);
+    }
+    return sum;
+}
+
+/*
+ * The sum of the dot products of all pairs of distinct columns equals the sum
+ * over all rows of ((sum of the row)^2 - (sum of its squares)) / 2, thus a
+ * single pass over the pattern suffices.
+ */
+double
+rfn::PatternKernels::complexity(const rfn::Matrix* const pattern)
+{
+    return _table.gram(pattern->data, pattern->size1, pattern->size2,
+        pattern->tda);
+}
+
+
+/*******************************************************************************
+ * Internal Functions
+ ******************************************************************************/
+
+
+rfn::PatternKernels::Table
+rfn::PatternKernels::select()
+{
+    Table table = {"scalar", &rfn::PatternKernels::squared_error_scalar,
+        &rfn::PatternKernels::gram_scalar};
+#ifdef RFN_X86_KERNELS
+    // may run before the constructors of libgcc
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        table.name = "avx512";
+        table.squared_error = &rfn::PatternKernels::squared_error_avx512;
+        table.gram = &rfn::PatternKernels::gram_avx512;
+    }
+    else if (__builtin_cpu_supports("avx2")) {
+        table.name = "avx2";
+        table.squared_error = &rfn::PatternKernels::squared_error_avx2;
+        table.gram = &rfn::PatternKernels::gram_avx2;
+    }
+#endif
+    return table;
+}
+
+double
+rfn::PatternKernels::reduce(const double* const lanes)
+{
+    return ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) +
+        ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+}
+
+double
+rfn::PatternKernels::squared_error_scalar(const double* const a,
+    const double* const b, const size_t n)
+{
+    double lanes[LANES] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+    double diff = 0.0;
+    size_t k = 0;
+    unsigned l = 0u;
+    for (; k + LANES <= n; k += LANES) {
+        for (l = 0; l < LANES; ++l) {
+            diff = a[k + l] - b[k + l];
+            lanes[l] += diff * diff;
+        }
+    }
+    for (l = 0; k < n; ++k, ++l) {
+        diff = a[k] - b[k];
+        lanes[l] += diff * diff;
+    }
+    return reduce(lanes);
+}
+
+double
+rfn::PatternKernels::gram_scalar(const double* const data, const size_t rows,
+    const size_t cols, const size_t tda)
+{
+    double sums[LANES];
+    double squares[LANES];
+    const double* row = NULL;
+    double sum = 0.0;
+    double total = 0.0;
+    size_t k = 0;
+    unsigned l = 0u;
+    for (size_t i = 0; i < rows; ++i) {
+        row = data + i * tda;
+        for (l = 0; l < LANES; ++l) {
+            sums[l] = 0.0;
+            squares[l] = 0.0;
+        }
+        for (k = 0; k + LANES <= cols; k += LANES) {
+            for (l = 0; l < LANES; ++l) {
+                sums[l] += row[k + l];
+                squares[l] += row[k + l] * row[k + l];
+            }
+        }
+        for (l = 0; k < cols; ++k, ++l) {
+            sums[l] += row[k];
+            squares[l] += row[k] * row[k];
+        }
+        sum = reduce(sums);
+        total += sum * sum - reduce(squares);
+    }
+    return 0.5 * total;
+}
+
+#ifdef RFN_X86_KERNELS
+
+__attribute__((target("avx2")))
+double
+rfn::PatternKernels::squared_error_avx2(const double* const a,
+    const double* const b, const size_t n)
+{
+    __m256d low = _mm256_setzero_pd();
+    __m256d high = _mm256_setzero_pd();
+    __m256d diff;
+    size_t k = 0;
+    for (; k + LANES <= n; k += LANES) {
+        diff = _mm256_sub_pd(_mm256_loadu_pd(a + k), _mm256_loadu_pd(b + k));
+        low = _mm256_add_pd(low, _mm256_mul_pd(diff, diff));
+        diff = _mm256_sub_pd(_mm256_loadu_pd(a + k + 4),
+            _mm256_loadu_pd(b + k + 4));
+        high = _mm256_add_pd(high, _mm256_mul_pd(diff, diff));
+    }
+    double lanes[LANES];
+    _mm256_storeu_pd(lanes, low);
+    _mm256_storeu_pd(lanes + 4, high);
+    double tail = 0.0;
+    for (unsigned l = 0; k < n; ++k, ++l) {
+        tail = a[k] - b[k];
+        lanes[l] += tail * tail;
+    }
+    return reduce(lanes);
+}
+
+__attribute__((target("avx2")))
+double
+rfn::PatternKernels::gram_avx2(const double* const data, const size_t rows,
+    const size_t cols, const size_t tda)
+{
+    double sums[LANES];
+    double squares[LANES];
+    __m256d sum_low, sum_high, square_low, square_high, values;
+    const double* row = NULL;
+    double sum = 0.0;
+    double total = 0.0;
+    size_t k = 0;
+    unsigned l = 0u;
+    for (size_t i = 0; i < rows; ++i) {
+        row = data + i * tda;
+        sum_low = _mm256_setzero_pd();
+        sum_high = _mm256_setzero_pd();
+        square_low = _mm256_setzero_pd();
+        square_high = _mm256_setzero_pd();
+        for (k = 0; k + LANES <= cols; k += LANES) {
+            values = _mm256_loadu_pd(row + k);
+            sum_low = _mm256_add_pd(sum_low, values);
+            square_low = _mm256_add_pd(square_low, _mm256_mul_pd(values,
+                values));
+            values = _mm256_loadu_pd(row + k + 4);
+            sum_high = _mm256_add_pd(sum_high, values);
+            square_high = _mm256_add_pd(square_high, _mm256_mul_pd(values,
+                values));
+        }
+        _mm256_storeu_pd(sums, sum_low);
+        _mm256_storeu_pd(sums + 4, sum_high);
+        _mm256_storeu_pd(squares, square_low);
+        _mm256_storeu_pd(squares + 4, square_high);
+        for (l = 0; k < cols; ++k, ++l) {
+            sums[l] += row[k];
+            squares[l] += row[k] * row[k];
+        }
+        sum = reduce(sums);
+        total += sum * sum - reduce(squares);
+    }
+    return 0.5 * total;
+}
+
+__attribute__((target("avx512f")))
+double
+rfn::PatternKernels::squared_error_avx512(const double* const a,
+    const double* const b, const size_t n)
+{
+    __m512d acc = _mm512_setzero_pd();
+    __m512d diff;
+    size_t k = 0;
+    for (; k + LANES <= n; k += LANES) {
+        diff = _mm512_sub_pd(_mm512_loadu_pd(a + k), _mm512_loadu_pd(b + k));
+        acc = _mm512_add_pd(acc, _mm512_mul_pd(diff, diff));
+    }
+    double lanes[LANES];
+    _mm512_storeu_pd(lanes, acc);
+    double tail = 0.0;
+    for (unsigned l = 0; k < n; ++k, ++l) {
+        tail = a[k] - b[k];
+        lanes[l] += tail * tail;
+    }
+    return reduce(lanes);
+}
+
+__attribute__((target("avx512f")))
+double
+rfn::PatternKernels::gram_avx512(const double* const data, const size_t rows,
+    const size_t cols, const size_t tda)
+{
+    double sums[LANES];
+    double squares[LANES];
+    __m512d sum_acc, square_acc, values;
+    const double* row = NULL;
+    double sum = 0.0;
+    double total = 0.0;
+    size_t k = 0;
+    unsigned l = 0u;
+    for (size_t i = 0; i < rows; ++i) {
+        row = data + i * tda;
+        sum_acc = _mm512_setzero_pd();
+        square_acc = _mm512_setzero_pd();
+        for (k = 0; k + LANES <= cols; k += LANES) {
+            values = _mm512_loadu_pd(row + k);
+            sum_acc = _mm512_add_pd(sum_acc, values);
+            square_acc = _mm512_add_pd(square_acc, _mm512_mul_pd(values,
+                values));
+        }
+        _mm512_storeu_pd(sums, sum_acc);
+        _mm512_storeu_pd(squares, square_acc);
+        for (l = 0; k < cols; ++k, ++l) {
+            sums[l] += row[k];
+            squares[l] += row[k] * row[k];
+        }
+        sum = reduce(sums);
+        total += sum * sum - reduce(squares);
+    }
+    return 0.5 * total;
+}
+
+#endif // RFN_X86_KERNELS
+
@@ -0,0 +1,111 @@
+/*******************************************************************************
+ * filename:    C_PatternKernels.hpp
+ * description: Vectorised kernels over output patterns
+ * author:      agent
+ * created:     2026-10-17
+ * copyright:   Jacobs University Bremen. All rights reserved.
+ *******************************************************************************
+ * The squared error between two patterns is evaluated for every mutated
+ * network and every robustness realisation, the complexity of a pattern, i.e.,
+ * the sum of the upper triangle of the Gram matrix of its columns, for every
+ * pattern drawn by the complexity initialisers.
+ *
+ * The kernels are chosen once at load time according to the instruction sets
+ * the CPU supports (AVX-512, AVX2 or plain scalar code). All variants
+ * accumulate element 'k' of a contiguous array into lane 'k % 8' of eight
+ * partial sums and combine the lanes in the same order, hence they produce
+ * bitwise identical results and an evolution does not depend on the machine
+ * it runs on.
+ ******************************************************************************/
+
+
+#ifndef _C_PATTERNKERNELS_HPP
+#define	_C_PATTERNKERNELS_HPP
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+
+// std
+#include <cstddef>
+
+// project
+#include "common_definitions.hpp"
+
+
+/*******************************************************************************
+ * Declarations
+ ******************************************************************************/
+
+
+// vectorised kernels need GCC's function specific target options
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define RFN_X86_KERNELS
+#endif
+
+
+namespace rfn {
+
+    class PatternKernels {
+
+    public:
+        // number of partial sums of every kernel
+        static const unsigned LANES = 8u;
+        // sum of the squared differences of the elements of 'a' and 'b'
+        typedef double (*SquaredError)(const double* const a,
+            const double* const b, const size_t n);
+        // sum over all rows of the products of the distinct elements of a row
+        typedef double (*Gram)(const double* const data, const size_t rows,
+            const size_t cols, const size_t tda);
+
+    protected:
+        /* Data Members */
+        struct Table {
+            const char* name;
+            SquaredError squared_error;
+            Gram gram;
+        };
+        static const Table _table;
+
+    public:
+        /* Member Functions */
+        // sum of the squared differences of two patterns of equal size
+        static double squared_error(const Matrix* const a,
+            const Matrix* const b);
+        // sum of the dot products of all pairs of distinct columns
+        static double complexity(const Matrix* const pattern);
+        // instruction set of the chosen kernels
+        static const char* instruction_set()
+        {
+            return _table.name;
+        }
+
+    protected:
+        /* Internal Functions */
+        static Table select();
+        // combine the partial sums in a fixed order
+        static double reduce(const double* const lanes);
+        static double squared_error_scalar(const double* const a,
+            const double* const b, const size_t n);
+        static double gram_scalar(const double* const data, const size_t rows,
+            const size_t cols, const size_t tda);
+#ifdef RFN_X86_KERNELS
+        static double squared_error_avx2(const double* const a,
+            const double* const b, const size_t n);
+        static double gram_avx2(const double* const data, const size_t rows,
+            const size_t cols, const size_t tda);
+        static double squared_error_avx512(const double* const a,
+            const double* const b, const size_t n);
+        static double gram_avx512(const double* const data, const size_t rows,
+            const size_t cols, const size_t tda);
+#endif
+
+    }; // class PatternKernels
+
+} // namespace rfn
+
+
+#endif	// _C_PATTERNKERNELS_HPP
+
@@ -0,0 +1,144 @@
+/*******************************************************************************
+ * filename:    C_Profile.cpp
+ * description: Implementation of 'Profile' class
+ * author:      agent
+ * created:     2026-10-17
+ * copyright:   Jacobs University Bremen. All rights reserved.
+ ******************************************************************************/
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+
+// std
+#include <iomanip>
+
+// project
+#include "C_Profile.hpp"
+
+
+/*******************************************************************************
+ * Static Data Members
+ ******************************************************************************/
+
+
+SINGLETON_THREAD_LOCAL rfn::Profile* rfn::Profile::_current = NULL;
+
+
+/*******************************************************************************
+ * Constructors & Destructor
+ ******************************************************************************/
+
+
+/*
+ * Default constructor
+ */
+rfn::Profile::Profile():
+    _accepted(0L),
+    _rejected(0L),
+    _recoveries(0L),
+    _phase(other),
+    _since(0ULL),
+    _start(0ULL),
+    _elapsed(0ULL),
+    _began(0.0),
+    _seconds(0.0),
+    _lock()
+{
+    for (unsigned k = 0; k < num_phases; ++k) {
+        this->_ticks[k] = 0ULL;
+        this->_calls[k] = 0L;
+    }
+}
+
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+
+
+void
+rfn::Profile::attach(const rfn::Profile::Phase phase)
+{
+    _current = this;
+    this->_phase = phase;
+    this->_began = wall_time();
+    this->_start = ticks();
+    this->_since = this->_start;
+}
+
+void
+rfn::Profile::detach()
+{
+    const Ticks now = ticks();
+    this->_ticks[this->_phase] += now - this->_since;
+    this->_since = now;
+    this->_elapsed += now - this->_start;
+    this->_seconds += wall_time() - this->_began;
+    if (_current == this) {
+        _current = NULL;
+    }
+}
+
+/*
+ * Several threads may end at the same time, only their phases and counts are
+ * added, the run time remains that of this profile.
+ */
+void
+rfn::Profile::merge(const rfn::Profile& other)
+{
+    boost::mutex::scoped_lock guard(this->_lock);
+    for (unsigned k = 0; k < num_phases; ++k) {
+        this->_ticks[k] += other._ticks[k];
+        this->_calls[k] += other._calls[k];
+    }
+    this->_accepted += other._accepted;
+    this->_rejected += other._rejected;
+    this->_recoveries += other._recoveries;
+}
+
+void
+rfn::Profile::report(std::ostream& out) const
+{
+    static const char* const names[num_phases] = {"other", "mutate", "build",
+        "factorise", "solve", "robustness", "io"};
+    const unsigned long steps = this->_accepted + this->_rejected;
+    const double per_tick = (this->_elapsed > 0ULL) ? this->_seconds /
+        (double)this->_elapsed : 0.0;
+    Ticks total = 0ULL;
+    unsigned k = 0u;
+    for (k = 0; k < num_phases; ++k) {
+        total += this->_ticks[k];
+    }
+    out << std::fixed;
+    out << "run time:            " << std::setprecision(3) << this->_seconds
+        << " s" << std::endl;
+    out << "steps:               " << steps << " (" << std::setprecision(1)
+        << ((this->_seconds > 0.0) ? steps / this->_seconds : 0.0)
+        << " per second)" << std::endl;
+    out << "accepted:            " << this->_accepted << std::endl;
+    out << "rejected:            " << this->_rejected << std::endl;
+    out << "singular recoveries: " << this->_recoveries << std::endl;
+    out << std::endl;
+    out << std::left << std::setw(12) << "phase" << std::right
+        << std::setw(12) << "calls" << std::setw(14) << "seconds"
+        << std::setw(10) << "share" << std::endl;
+    for (k = 0; k < num_phases; ++k) {
+        out << std::left << std::setw(12) << names[k] << std::right
+            << std::setw(12) << this->_calls[k] << std::setw(14)
+            << std::setprecision(3) << this->_ticks[k] * per_tick
+            << std::setw(8) << std::setprecision(1)
+            << ((total > 0ULL) ? 100.0 * this->_ticks[k] / total : 0.0)
+            << " %" << std::endl;
+    }
+}
+
+double
+rfn::Profile::wall_time()
+{
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + 1e-9 * (double)now.tv_nsec;
+}
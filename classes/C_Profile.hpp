@@ -0,0 +1,226 @@
+/*******************************************************************************
+ * filename:    C_Profile.hpp
+ * description: Per-phase timing and event counters of an evolution
+ * author:      agent
+ * created:     2026-10-17
+ * copyright:   Jacobs University Bremen. All rights reserved.
+ *******************************************************************************
+ * With '--profile' every network records where the time of its evolution goes
+ * and writes a report to '<name>_profile.txt' when it is done. A thread is
+ * always in exactly one phase, a 'Scope' switches to another one for its life
+ * time and charges the ticks since the last switch to the phase it leaves,
+ * thus nested phases are not counted twice and all phases add up to the run
+ * time of the thread.
+ *
+ * Ticks are read from the time stamp counter on x86 and from the monotonic
+ * clock elsewhere and converted to seconds with the wall time of the whole
+ * run. Without an attached profile a scope only tests a thread local pointer.
+ *
+ * Threads started with 'task' begin in the phase of the thread that started
+ * them and add their counts to its profile when they end, hence with several
+ * threads the phases add up to more than the run time.
+ ******************************************************************************/
+
+
+#ifndef _C_PROFILE_HPP
+#define	_C_PROFILE_HPP
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+
+// std
+#include <ostream>
+#include <time.h>
+
+// boost
+#include <boost/thread/mutex.hpp>
+
+// project
+#include "M_Singleton.hpp"
+
+
+/*******************************************************************************
+ * Declarations
+ ******************************************************************************/
+
+
+namespace rfn {
+
+    class Profile {
+
+    public:
+        enum Phase {
+            other,
+            mutate,
+            build,
+            factorise,
+            solve,
+            robustness,
+            io,
+            num_phases
+        };
+        typedef unsigned long long Ticks;
+
+        // the calling thread is in 'phase' for the life time of a scope
+        class Scope {
+        protected:
+            Profile* const _profile;
+            Phase _previous;
+
+        public:
+            explicit Scope(const Phase phase):
+                _profile(Profile::_current),
+                _previous(other)
+            {
+                if (this->_profile != NULL) {
+                    this->_previous = this->_profile->enter(phase);
+                }
+            }
+            ~Scope()
+            {
+                if (this->_profile != NULL) {
+                    this->_profile->leave(this->_previous);
+                }
+            }
+        };
+
+        // runs 'Function' with a profile of its own that is merged into the
+        // profile of the thread which created the task
+        template <typename Function>
+        class Task {
+        protected:
+            Profile* _parent;
+            Phase _phase;
+            Function _function;
+
+        public:
+            Task(Profile* const parent, const Function& function):
+                _parent(parent),
+                _phase((parent != NULL) ? parent->_phase : other),
+                _function(function)
+            {}
+            void operator()()
+            {
+                if (this->_parent == NULL) {
+                    this->_function();
+                    return;
+                }
+                Profile own;
+                own.attach(this->_phase);
+                this->_function();
+                own.detach();
+                this->_parent->merge(own);
+            }
+        };
+
+    protected:
+        /* Data Members */
+        static SINGLETON_THREAD_LOCAL Profile* _current;
+        Ticks _ticks[num_phases];
+        unsigned long _calls[num_phases];
+        unsigned long _accepted;
+        unsigned long _rejected;
+        unsigned long _recoveries;
+        Phase _phase;
+        Ticks _since;
+        Ticks _start;
+        Ticks _elapsed;
+        double _began;
+        double _seconds;
+        boost::mutex _lock;
+
+    public:
+        /* Constructors & Destructor */
+        Profile();
+
+        /* Member Functions */
+        // profile of the calling thread, NULL if there is none
+        static Profile* current()
+        {
+            return _current;
+        }
+        // 'f' as a thread body that profiles into the current profile
+        template <typename Function>
+        static Task<Function> task(const Function& f)
+        {
+            return Task<Function>(_current, f);
+        }
+        // 'f' as a task that profiles into 'parent', which may be NULL
+        template <typename Function>
+        static Task<Function> task(Profile* const parent, const Function& f)
+        {
+            return Task<Function>(parent, f);
+        }
+        // record the calling thread from now on
+        void attach(const Phase phase = other);
+        // stop recording the calling thread
+        void detach();
+        // one evolutionary step of the current profile
+        static void step(const bool accepted)
+        {
+            if (_current != NULL) {
+                if (accepted) {
+                    ++_current->_accepted;
+                }
+                else {
+                    ++_current->_rejected;
+                }
+            }
+        }
+        // one network evaluation of the current profile that failed
+        static void recovery()
+        {
+            if (_current != NULL) {
+                ++_current->_recoveries;
+            }
+        }
+        // add the counts of 'other', which must be detached
+        void merge(const Profile& other);
+        // human readable summary
+        void report(std::ostream& out) const;
+        // seconds of the monotonic clock
+        static double wall_time();
+        // current value of the tick counter
+        static Ticks ticks()
+        {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+            return __builtin_ia32_rdtsc();
+#else
+            timespec now;
+            clock_gettime(CLOCK_MONOTONIC, &now);
+            return (Ticks)now.tv_sec * 1000000000ULL + (Ticks)now.tv_nsec;
+#endif
+        }
+
+    protected:
+        /* Internal Functions */
+        Phase enter(const Phase phase)
+        {
+            const Ticks now = ticks();
+            const Phase previous = this->_phase;
+            this->_ticks[previous] += now - this->_since;
+            ++this->_calls[phase];
+            this->_phase = phase;
+            this->_since = now;
+            return previous;
+        }
+        void leave(const Phase previous)
+        {
+            const Ticks now = ticks();
+            this->_ticks[this->_phase] += now - this->_since;
+            this->_phase = previous;
+            this->_since = now;
+        }
+
+    private:
+        Profile(const Profile&);
+        Profile& operator=(const Profile&);
+    };
+
+} // namespace rfn
+
+
+#endif // _C_PROFILE_HPP
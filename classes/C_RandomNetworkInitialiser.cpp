@@ -65,7 +65,7 @@ rfn::RandomNetworkInitialiser::init(rfn::ParameterManager* const parameters,
             // only middle and output nodes have incoming links
             if (parameters->regards_structure(i, j)) {
                 if (bool_gen()) {
-                    boost::add_edge(i, j, *network);
+                    network->add_edge(i, j);
                 }
             }
         }
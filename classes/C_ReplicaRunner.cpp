@@ -0,0 +1,182 @@
+/*******************************************************************************
+ * filename:    C_ReplicaRunner.cpp
+ * description: Implementation of 'ReplicaRunner' class
+ * author:      agent
+ * created:     2026-10-17
+ * copyright:   Jacobs University Bremen. All rights reserved.
+ ******************************************************************************/
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+
+// std
+#include <iostream>
+#include <algorithm>
+#include <sstream>
+
+// boost
+#include <boost/bind/bind.hpp>
+#include <boost/thread/thread.hpp>
+
+// project
+#include "C_ReplicaRunner.hpp"
+#include "C_NetworkBuilder.hpp"
+#include "C_FlowDistributionNetwork.hpp"
+#include "C_Evolution.hpp"
+#include "C_Mutation.hpp"
+#include "C_NetworkInitialiser.hpp"
+#include "C_PatternInitialiser.hpp"
+#include "C_Profile.hpp"
+
+
+/*******************************************************************************
+ * Constructors & Destructor
+ ******************************************************************************/
+
+
+/*
+ * Default constructor
+ */
+rfn::ReplicaRunner::ReplicaRunner(
+    rfn::ParameterManager const* const parameters):
+    _template(parameters),
+    _replicas(),
+    _next(0u),
+    _lock(),
+    _telemetry(NULL),
+    _archive(NULL),
+    _writer(NULL)
+{}
+
+/*
+ * Destructor
+ */
+rfn::ReplicaRunner::~ReplicaRunner()
+{
+    this->_template = NULL; // singleton destroys itself
+}
+
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+
+
+void
+rfn::ReplicaRunner::add(const std::string& name, const unsigned seed,
+    const double connectivity)
+{
+    Replica replica;
+    replica.name = name;
+    replica.seed = seed;
+    replica.connectivity = connectivity;
+    this->_replicas.push_back(replica);
+}
+
+/*
+ * Even a single job runs in its own thread so that it does not share the
+ * singletons of the calling thread.
+ */
+void
+rfn::ReplicaRunner::run()
+{
+    const unsigned num_jobs = std::max(1u, std::min(this->_template->jobs(),
+        (unsigned)this->_replicas.size()));
+    this->_next = 0u;
+    if (!this->_template->telemetry().empty()) {
+        this->_telemetry = new rfn::Telemetry(this->_template->telemetry(),
+            this->_template->telemetry_interval());
+        CHECK_CRITICAL_POINTER(this->_telemetry);
+    }
+    if (!this->_template->archive().empty()) {
+        this->_archive = new rfn::Archive(this->_template->archive(), true);
+        CHECK_CRITICAL_POINTER(this->_archive);
+    }
+    this->_writer = new rfn::SnapshotWriter();
+    CHECK_CRITICAL_POINTER(this->_writer);
+    boost::thread_group workers;
+    for (unsigned t = 0; t < num_jobs; ++t) {
+        workers.create_thread(boost::bind(&rfn::ReplicaRunner::work, this));
+    }
+    workers.join_all();
+    delete this->_telemetry;
+    this->_telemetry = NULL;
+    // writes what is left before the archive is closed
+    delete this->_writer;
+    this->_writer = NULL;
+    delete this->_archive;
+    this->_archive = NULL;
+    this->_replicas.clear();
+}
+
+
+/*******************************************************************************
+ * Internal Functions
+ ******************************************************************************/
+
+
+void
+rfn::ReplicaRunner::work()
+{
+    unsigned i = 0u;
+    while (true) {
+        {
+            boost::mutex::scoped_lock guard(this->_lock);
+            if (this->_next >= this->_replicas.size()) {
+                break;
+            }
+            i = this->_next++;
+        }
+        this->evolve(this->_replicas[i]);
+    }
+}
+
+void
+rfn::ReplicaRunner::evolve(const Replica& replica)
+{
+    rfn::ParameterManager* const parameters = rfn::ParameterManager::instance(
+        this->_template->network_type());
+    parameters->assign(this->_template);
+    parameters->seed(replica.seed);
+    parameters->connectivity(replica.connectivity);
+    rfn::Evolution* const evolution = rfn::Evolution::instance(
+        parameters->network_type());
+    rfn::FlowDistributionNetwork* network = rfn::NetworkBuilder::instance()->
+        build(parameters, replica.name);
+    evolution->telemetry(this->_telemetry);
+    evolution->archive(this->_archive);
+    evolution->writer(this->_writer);
+    if (parameters->resume() && !evolution->resume(network)) {
+        std::cout << "Network '" << network->name() << "' has finished"
+            " already, skipped." << std::endl;
+    }
+    else {
+        rfn::Profile profile;
+        if (parameters->profile()) {
+            profile.attach();
+        }
+        evolution->run(network);
+        if (parameters->profile()) {
+            profile.detach();
+            std::stringstream filename;
+            filename << network->name() << "_profile.txt";
+            bfsys::ofstream output(filename.str());
+            output << "network:             " << network->name() << std::endl;
+            profile.report(output);
+            output.close();
+        }
+    }
+    delete network;
+    network = NULL;
+    // singletons of this thread are created anew for the next replica
+    rfn::Evolution::release();
+    rfn::Mutation::release();
+    rfn::PatternInitialiser::release();
+    rfn::NetworkInitialiser::release();
+    rfn::NetworkBuilder::release();
+    rfn::ParameterManager::release();
+}
+
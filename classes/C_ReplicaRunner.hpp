@@ -0,0 +1,91 @@
+/*******************************************************************************
+ * filename:    C_ReplicaRunner.hpp
+ * description: Evolves independent networks concurrently
+ * author:      agent
+ * created:     2026-10-17
+ * copyright:   Jacobs University Bremen. All rights reserved.
+ *******************************************************************************
+ * Each replica is evolved in one of 'jobs()' worker threads. Since singletons
+ * are local to the thread that creates them, a replica builds its own
+ * parameters, random number generator, mutation, initialisers and evolution
+ * from a template and releases them when it is done. The outcome of a replica
+ * thus depends only on its seed and not on the number of jobs.
+ ******************************************************************************/
+
+
+#ifndef _C_REPLICARUNNER_HPP
+#define	_C_REPLICARUNNER_HPP
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+
+// std
+#include <string>
+#include <vector>
+
+// boost
+#include <boost/thread/mutex.hpp>
+
+// project
+#include "common_definitions.hpp"
+#include "C_ParameterManager.hpp"
+#include "C_Telemetry.hpp"
+#include "C_Archive.hpp"
+#include "C_SnapshotWriter.hpp"
+
+
+/*******************************************************************************
+ * Declarations
+ ******************************************************************************/
+
+
+namespace rfn {
+
+    class ReplicaRunner {
+
+    protected:
+        struct Replica {
+            std::string name;
+            unsigned seed;
+            double connectivity;
+        };
+        /* Data Members */
+        ParameterManager const* _template;
+        std::vector<Replica> _replicas;
+        unsigned _next;
+        boost::mutex _lock;
+        // shared by all replicas, NULL without '--telemetry'
+        Telemetry* _telemetry;
+        // shared by all replicas, NULL without '--archive'
+        Archive* _archive;
+        // writes the states of all replicas
+        SnapshotWriter* _writer;
+
+    public:
+        /* Constructors & Destructor */
+        ReplicaRunner(ParameterManager const* const parameters);
+        virtual ~ReplicaRunner();
+
+        /* Member Functions */
+        // queue a network for evolution
+        void add(const std::string& name, const unsigned seed,
+            const double connectivity);
+        // evolve all queued networks and wait for them to finish
+        void run();
+
+    protected:
+        /* Internal Functions */
+        // evolve queued networks until none are left
+        void work();
+        void evolve(const Replica& replica);
+
+    }; // class ReplicaRunner
+
+} // namespace rfn
+
+
+#endif	// _C_REPLICARUNNER_HPP
+
@@ -0,0 +1,315 @@
+/*******************************************************************************
+ * filename:    C_ResultView.cpp
+ * description: Implementation of 'ResultView' class
+ * author:      agent
+ * created:     2026-10-17
+ * copyright:   Jacobs University Bremen. All rights reserved.
+ ******************************************************************************/
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+
+// std
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// boost
+#include <boost/static_assert.hpp>
+
+// project
+#include "C_ResultView.hpp"
+
+
+/*******************************************************************************
+ * Constructors & Destructor
+ ******************************************************************************/
+
+
+BOOST_STATIC_ASSERT(sizeof(rfn::ResultView::Edge) == 2 * sizeof(unsigned));
+
+rfn::ResultView::ResultView():
+    _map(NULL),
+    _length(0),
+    _iteration(0L),
+    _seed(0u),
+    _connectivity(0.0),
+    _flow_error(0.0),
+    _robustness(-1.0),
+    _edges(),
+    _pattern(),
+    _layers(),
+    _edge_copy(),
+    _pattern_copy()
+{
+    this->_layers.nodes_in = 0u;
+    this->_layers.nodes_middle = 0u;
+    this->_layers.nodes_out = 0u;
+}
+
+/*
+ * Destructor
+ */
+rfn::ResultView::~ResultView()
+{
+    this->close();
+}
+
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+
+
+/*
+ * 'parameters.dat' starts with the version of the program followed by the
+ * layer sizes.
+ */
+bool
+rfn::ResultView::layers(const std::string& path, rfn::ResultView::Layers& sizes)
+{
+    bfsys::ifstream in(path, std::ios::binary);
+    rfn::BinaryReader reader(in, rfn::BinaryFormat::PARAMETERS_MAGIC);
+    reader.get_u16();
+    sizes.nodes_in = reader.get_u16();
+    sizes.nodes_middle = reader.get_u16();
+    sizes.nodes_out = reader.get_u16();
+    return in && sizes.nodes_in > 0u && sizes.nodes_out > 0u;
+}
+
+bool
+rfn::ResultView::open(const std::string& path,
+    const rfn::ResultView::Layers& sizes)
+{
+    this->close();
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+        ::close(fd);
+        return false;
+    }
+    const size_t length = (size_t)info.st_size;
+    void* const map = mmap(NULL, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (map == MAP_FAILED) {
+        return false;
+    }
+    this->_map = static_cast<const char*>(map);
+    this->_length = length;
+    const bool success = (length >= rfn::BinaryFormat::MAGIC_SIZE &&
+        std::memcmp(this->_map, rfn::BinaryFormat::STATE_MAGIC,
+        rfn::BinaryFormat::MAGIC_SIZE) == 0) ? this->open_portable() :
+        this->open_legacy(sizes);
+    if (!success) {
+        this->close();
+    }
+    return success;
+}
+
+bool
+rfn::ResultView::open(const std::string& path)
+{
+    Layers unknown = {0u, 0u, 0u};
+    return this->open(path, unknown);
+}
+
+void
+rfn::ResultView::close()
+{
+    if (this->_map != NULL) {
+        munmap(const_cast<char*>(this->_map), this->_length);
+    }
+    this->_map = NULL;
+    this->_length = 0;
+    this->_iteration = 0L;
+    this->_seed = 0u;
+    this->_connectivity = 0.0;
+    this->_flow_error = 0.0;
+    this->_robustness = -1.0;
+    this->_edges = Span<Edge>();
+    this->_pattern = Span<double>();
+    this->_layers.nodes_in = 0u;
+    this->_layers.nodes_middle = 0u;
+    this->_layers.nodes_out = 0u;
+    this->_edge_copy.clear();
+    this->_pattern_copy.clear();
+}
+
+
+/*******************************************************************************
+ * Internal Functions
+ ******************************************************************************/
+
+
+/*
+ * The checksum covers the whole file, thus the fields need not be checked
+ * against the length beyond what is required to find them.
+ */
+bool
+rfn::ResultView::open_portable()
+{
+    const size_t fixed = 56;
+    if (this->_length < fixed + rfn::BinaryFormat::TRAILER_SIZE) {
+        return false;
+    }
+    const size_t body = this->_length - rfn::BinaryFormat::TRAILER_SIZE;
+    if (decode_u32(this->_map + body) != rfn::BinaryFormat::checksum(
+        this->_map, body) || decode_u32(this->_map +
+        rfn::BinaryFormat::MAGIC_SIZE) > rfn::BinaryFormat::VERSION)
+    {
+        return false;
+    }
+    this->_layers.nodes_in = decode_u32(this->_map + 12);
+    this->_layers.nodes_middle = decode_u32(this->_map + 16);
+    this->_layers.nodes_out = decode_u32(this->_map + 20);
+    this->_iteration = (unsigned long)decode_u64(this->_map + 24);
+    this->_seed = decode_u32(this->_map + 32);
+    this->_connectivity = decode_f64(this->_map + 36);
+    this->_flow_error = decode_f64(this->_map + 44);
+    const unsigned num_edges = decode_u32(this->_map + 52);
+    const size_t cells = (size_t)this->_layers.nodes_in *
+        this->_layers.nodes_out;
+    const size_t values = fixed + (size_t)num_edges * sizeof(Edge) +
+        cells * sizeof(double);
+    if (body != values && body != values + sizeof(double)) {
+        return false;
+    }
+    this->place(fixed, num_edges, true);
+    if (body > values) {
+        this->_robustness = decode_f64(this->_map + values);
+    }
+    return true;
+}
+
+/*
+ * The scalars in front of the links are not aligned and therefore copied, the
+ * links and the pattern are referred to where they are in the mapping.
+ */
+bool
+rfn::ResultView::open_legacy(const rfn::ResultView::Layers& sizes)
+{
+    size_t pos = 0;
+    unsigned num_edges = 0u;
+    const size_t fixed = sizeof(unsigned long) + 2 * sizeof(unsigned) +
+        2 * sizeof(double);
+    if (sizes.nodes_in == 0u || sizes.nodes_out == 0u
+        || this->_length < fixed)
+    {
+        return false;
+    }
+    this->_layers = sizes;
+    std::memcpy(&this->_iteration, this->_map + pos, sizeof(unsigned long));
+    pos += sizeof(unsigned long);
+    std::memcpy(&this->_seed, this->_map + pos, sizeof(unsigned));
+    pos += sizeof(unsigned);
+    std::memcpy(&this->_connectivity, this->_map + pos, sizeof(double));
+    pos += sizeof(double);
+    std::memcpy(&this->_flow_error, this->_map + pos, sizeof(double));
+    pos += sizeof(double);
+    std::memcpy(&num_edges, this->_map + pos, sizeof(unsigned));
+    pos += sizeof(unsigned);
+    // the remainder has to fit links, pattern and possibly robustness
+    const size_t cells = (size_t)sizes.nodes_in * sizes.nodes_out;
+    const size_t values = pos + (size_t)num_edges * sizeof(Edge) +
+        cells * sizeof(double);
+    if (this->_length != values && this->_length != values + sizeof(double)) {
+        return false;
+    }
+    this->place(pos, num_edges, false);
+    if (this->_length > values) {
+        std::memcpy(&this->_robustness, this->_map + values, sizeof(double));
+    }
+    return true;
+}
+
+/*
+ * Links and pattern are used in place if they are stored in the byte order of
+ * this machine and aligned, otherwise they are decoded into copies.
+ */
+void
+rfn::ResultView::place(size_t pos, const unsigned num_edges,
+    const bool portable)
+{
+    const bool native = !portable || rfn::BinaryFormat::little_endian();
+    const size_t cells = (size_t)this->_layers.nodes_in *
+        this->_layers.nodes_out;
+    size_t k = 0;
+    if (native && pos % sizeof(unsigned) == 0) {
+        this->_edges = Span<Edge>(reinterpret_cast<const Edge*>(this->_map +
+            pos), num_edges);
+    }
+    else if (num_edges > 0) {
+        this->_edge_copy.resize(num_edges);
+        if (native) {
+            std::memcpy(&this->_edge_copy[0], this->_map + pos,
+                num_edges * sizeof(Edge));
+        }
+        else {
+            for (k = 0; k < num_edges; ++k) {
+                this->_edge_copy[k].source = decode_u32(this->_map + pos +
+                    k * sizeof(Edge));
+                this->_edge_copy[k].target = decode_u32(this->_map + pos +
+                    k * sizeof(Edge) + sizeof(unsigned));
+            }
+        }
+        this->_edges = Span<Edge>(&this->_edge_copy[0], num_edges);
+    }
+    pos += num_edges * sizeof(Edge);
+    if (native && pos % sizeof(double) == 0) {
+        this->_pattern = Span<double>(reinterpret_cast<const double*>(
+            this->_map + pos), cells);
+    }
+    else if (cells > 0) {
+        this->_pattern_copy.resize(cells);
+        if (native) {
+            std::memcpy(&this->_pattern_copy[0], this->_map + pos,
+                cells * sizeof(double));
+        }
+        else {
+            for (k = 0; k < cells; ++k) {
+                this->_pattern_copy[k] = decode_f64(this->_map + pos +
+                    k * sizeof(double));
+            }
+        }
+        this->_pattern = Span<double>(&this->_pattern_copy[0], cells);
+    }
+}
+
+boost::uint32_t
+rfn::ResultView::decode_u32(const char* const bytes)
+{
+    return (boost::uint32_t)decode(bytes, 4);
+}
+
+boost::uint64_t
+rfn::ResultView::decode_u64(const char* const bytes)
+{
+    return decode(bytes, 8);
+}
+
+double
+rfn::ResultView::decode_f64(const char* const bytes)
+{
+    const boost::uint64_t bits = decode(bytes, 8);
+    double value = 0.0;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+boost::uint64_t
+rfn::ResultView::decode(const char* const bytes, const unsigned size)
+{
+    boost::uint64_t value = 0u;
+    for (unsigned b = 0; b < size; ++b) {
+        value |= (boost::uint64_t)(unsigned char)bytes[b] << (8 * b);
+    }
+    return value;
+}
@@ -0,0 +1,214 @@
+/*******************************************************************************
+ * filename:    C_ResultView.hpp
+ * description: Read-only memory mapped view of a network result file
+ * author:      agent
+ * created:     2026-10-17
+ * copyright:   Jacobs University Bremen. All rights reserved.
+ *******************************************************************************
+ * A result file ('<name>_final.dat', '<name>_flow.dat' or a snapshot) as
+ * written by 'FlowDistributionNetwork::write_to_binary_stream' is mapped into
+ * memory and its links and ideal pattern are exposed in place:
+ *
+ *  header        magic "RFNSTATE" and format version (u32)
+ *  layers        nodes_in, nodes_middle and nodes_out (u32 each)
+ *  iteration     u64
+ *  seed          u32
+ *  connectivity  f64
+ *  flow error    f64
+ *  links         u32, then that many (source, target) pairs of u32
+ *  pattern       'nodes_out' rows of 'nodes_in' f64
+ *  robustness    f64, only written by robust networks
+ *  checksum      CRC-32 of all preceding bytes (u32)
+ *
+ * See 'BinaryFormat' for the encoding. The links start 56 bytes into the file,
+ * thus on little-endian machines opening a file neither copies nor allocates.
+ * Legacy files lack header, layers and checksum and are laid out like the
+ * machine that wrote them, they are read if the layer sizes are given, e.g.,
+ * from the 'parameters.dat' next to them, see 'layers'. A view is not shared
+ * between threads, opening many files in parallel is fine.
+ ******************************************************************************/
+
+
+#ifndef _C_RESULTVIEW_HPP
+#define	_C_RESULTVIEW_HPP
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+
+// std
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// boost
+#include <boost/cstdint.hpp>
+
+// project
+#include "common_definitions.hpp"
+#include "C_BinaryStream.hpp"
+
+
+/*******************************************************************************
+ * Declarations
+ ******************************************************************************/
+
+
+namespace rfn {
+
+    // contiguous sequence of 'T' owned by someone else
+    template <typename T>
+    class Span {
+
+    protected:
+        const T* _data;
+        size_t _size;
+
+    public:
+        Span():
+            _data(NULL),
+            _size(0)
+        {}
+        Span(const T* const data, const size_t size):
+            _data(data),
+            _size(size)
+        {}
+        const T* begin() const
+        {
+            return this->_data;
+        }
+        const T* end() const
+        {
+            return this->_data + this->_size;
+        }
+        size_t size() const
+        {
+            return this->_size;
+        }
+        bool empty() const
+        {
+            return this->_size == 0;
+        }
+        const T& operator[](const size_t i) const
+        {
+            return this->_data[i];
+        }
+    };
+
+    class ResultView {
+
+    public:
+        // a link as stored in the file
+        struct Edge {
+            unsigned source;
+            unsigned target;
+        };
+
+        // sizes of the network layers
+        struct Layers {
+            unsigned nodes_in;
+            unsigned nodes_middle;
+            unsigned nodes_out;
+        };
+
+    protected:
+        /* Data Members */
+        const char* _map;
+        size_t _length;
+        unsigned long _iteration;
+        unsigned _seed;
+        double _connectivity;
+        double _flow_error;
+        double _robustness;
+        Span<Edge> _edges;
+        Span<double> _pattern;
+        Layers _layers;
+        // decoded links and pattern where they cannot be used in place
+        std::vector<Edge> _edge_copy;
+        std::vector<double> _pattern_copy;
+
+    public:
+        /* Constructors & Destructor */
+        ResultView();
+        ~ResultView();
+
+        /* Member Functions */
+        // read the layer sizes from a 'parameters.dat', false if it is no
+        // such file
+        static bool layers(const std::string& path, Layers& sizes);
+        // map the result file 'path', false and empty if the file cannot be
+        // read, is damaged or, for a legacy file, does not match 'sizes'
+        bool open(const std::string& path, const Layers& sizes);
+        // map the result file 'path', which must not be a legacy file
+        bool open(const std::string& path);
+        // unmap the current file
+        void close();
+        bool is_open() const
+        {
+            return this->_map != NULL;
+        }
+        // _iteration get method
+        unsigned long iteration() const
+        {
+            return this->_iteration;
+        }
+        // _seed get method
+        unsigned seed() const
+        {
+            return this->_seed;
+        }
+        // _connectivity get method
+        double connectivity() const
+        {
+            return this->_connectivity;
+        }
+        // _flow_error get method
+        double flow_error() const
+        {
+            return this->_flow_error;
+        }
+        // _robustness get method, negative unless the network is robust
+        double robustness() const
+        {
+            return this->_robustness;
+        }
+        // _layers get method
+        const Layers& layers() const
+        {
+            return this->_layers;
+        }
+        // _edges get method, ordered by source and target
+        const Span<Edge>& edges() const
+        {
+            return this->_edges;
+        }
+        // _pattern get method, row-major
+        const Span<double>& pattern() const
+        {
+            return this->_pattern;
+        }
+
+    protected:
+        /* Internal Functions */
+        bool open_portable();
+        bool open_legacy(const Layers& sizes);
+        // links and pattern of 'num_edges' links starting at 'pos'
+        void place(size_t pos, const unsigned num_edges, const bool portable);
+        // little-endian numbers at 'bytes'
+        static boost::uint32_t decode_u32(const char* const bytes);
+        static boost::uint64_t decode_u64(const char* const bytes);
+        static double decode_f64(const char* const bytes);
+        static boost::uint64_t decode(const char* const bytes,
+            const unsigned size);
+
+    private:
+        ResultView(const ResultView&);
+        ResultView& operator=(const ResultView&);
+    };
+
+} // namespace rfn
+
+
+#endif // _C_RESULTVIEW_HPP
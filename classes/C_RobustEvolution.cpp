@@ -16,13 +16,16 @@
 
 // std
 #include <iostream>
+#include <vector>
 
 // gsl
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_sf_exp.h>
+#include <gsl/gsl_sf_log.h>
 
 // project
 #include "C_RobustEvolution.hpp"
+#include "C_Profile.hpp"
 
 
 /*******************************************************************************
@@ -35,7 +38,8 @@
  */
 rfn::RobustEvolution::RobustEvolution():
     rfn::Evolution(),
-    _robust_parameters(NULL)
+    _robust_parameters(NULL),
+    _intermediate(true)
 {
     this->_robust_parameters = dynamic_cast<rfn::RobustParameterManager*>
         (this->_parameters);
@@ -67,7 +71,6 @@ rfn::RobustEvolution::run(rfn::FlowDistributionNetwork* const f_net)
         <rfn::RobustFunctionalNetwork*>(f_net);
     unsigned when = 0u;
     bool store = false;
-    bool intermediate = true;
     if (this->_parameters->snapshots() > 0) {
         store = true;
         when = this->_parameters->max_time() /
@@ -76,6 +79,7 @@ rfn::RobustEvolution::run(rfn::FlowDistributionNetwork* const f_net)
 #ifdef VERBOSE
     cout << endl;
 #endif
+    this->start_progress();
     // use the actual _current_time for the evolution
     for (; this->_current_time <= this->_parameters->max_time();
         ++this->_current_time)
@@ -87,14 +91,18 @@ rfn::RobustEvolution::run(rfn::FlowDistributionNetwork* const f_net)
             << rf_net->robustness() << endl;
         }
 #endif
-        // store item in history
+        this->checkpoint(rf_net);
         if (store) {
             if (this->_current_time % when == 0) {
-                rf_net->save(this->_current_time);
+                this->snapshot(rf_net, this->_current_time);
             }
         }
         // proceed in evolution
-        this->step(rf_net);
+        ++this->_attempted;
+        if (this->step(rf_net)) {
+            ++this->_accepted;
+        }
+        this->progress(rf_net, rf_net->robustness(), false);
         // check for abortion criteria
         if (gsl_fcmp(rf_net->robustness(),
             this->_robust_parameters->min_robustness(), GSL_EPSILON) >= 0)
@@ -102,17 +110,14 @@ rfn::RobustEvolution::run(rfn::FlowDistributionNetwork* const f_net)
             // robustness is greater than or equal to the required threshold
             break;
         }
-        if (intermediate && gsl_fcmp(f_net->flow_error(),
+        if (this->_intermediate && gsl_fcmp(f_net->flow_error(),
             this->_parameters->error_threshold(), GSL_EPSILON) < 0)
         {
             // flow error is smaller than the required threshold
             // save intermediate state
-            std::stringstream filename;
-            filename << rf_net->name() << "_flow.dat";
-            bfsys::ofstream output(filename.str(), std::ios::binary);
-            rf_net->write_to_binary_stream(output, this->_current_time);
-            output.close();
-            intermediate = false;
+            this->write_state(rf_net, rfn::Archive::flow_record, "flow",
+                this->_current_time);
+            this->_intermediate = false;
         }
     }
 #ifdef VERBOSE
@@ -127,29 +132,45 @@ rfn::RobustEvolution::run(rfn::FlowDistributionNetwork* const f_net)
                 << rf_net->robustness() << endl;
     cout << endl;
 #endif
-    if (store) {
-        rf_net->store();
-    }
-    std::stringstream filename;
-    filename << rf_net->name() << "_final.dat";
-    bfsys::ofstream output(filename.str(), std::ios::binary);
-    rf_net->write_to_binary_stream(output, (this->_current_time <=
-        this->_parameters->max_time()) ? this->_current_time :
-        this->_parameters->max_time());
-    output.close();
+    this->write_state(rf_net, rfn::Archive::final_record, "final",
+        (this->_current_time <= this->_parameters->max_time()) ?
+        this->_current_time : this->_parameters->max_time());
+    this->submit(rfn::SnapshotWriter::remove_file,
+        this->checkpoint_path(rf_net), "");
+    this->progress(rf_net, rf_net->robustness(), true);
 }
 
 /*
  * One evolutionary step
  */
-void
+bool
 rfn::RobustEvolution::step(rfn::RobustFunctionalNetwork* const rf_net)
 {
+    if (this->_parameters->candidates() > 1) {
+        return this->population_step(rf_net);
+    }
     // calculate flow error
     rfn::RobustFunctionalNetwork* next(static_cast
-        <rfn::RobustFunctionalNetwork*>(rf_net->clone()));
-    CHECK_CRITICAL_POINTER(next);
-    next->mutate();
+        <rfn::RobustFunctionalNetwork*>(rf_net->candidate()));
+    {
+        rfn::Profile::Scope scope(rfn::Profile::mutate);
+        next->mutate();
+    }
+    const bool accepted = this->accept(rf_net, next);
+    if (accepted) {
+        rf_net->exchange(*next);
+    }
+    rfn::Profile::step(accepted);
+    return accepted;
+}
+
+/*
+ * Acceptance criterion of a mutated network
+ */
+bool
+rfn::RobustEvolution::accept(rfn::RobustFunctionalNetwork* const rf_net,
+    rfn::RobustFunctionalNetwork* const next)
+{
     if (gsl_fcmp(rf_net->flow_error(), this->_parameters->error_threshold(),
         GSL_EPSILON) < 0)
     {
@@ -158,42 +179,156 @@ rfn::RobustEvolution::step(rfn::RobustFunctionalNetwork* const rf_net)
         {
             // mutated network not below flow error threshold, i.e., it cannot be
             // robust
-            delete next;
-            return;
+            return false;
         }
         // flow error is smaller than threshold: test robustness
+        if (this->_robust_parameters->confidence() > 0.0) {
+            return next->robustness_exceeds(this->acceptance_bound(
+                rf_net->robustness()));
+        }
         if (gsl_fcmp(next->robustness(), rf_net->robustness(), GSL_EPSILON) > 0)
         {
             // robustness is greater than old one
-            *rf_net = *next;
+            return true;
         }
-        else {
-            // small probability of accepting change anyway to avoid local minima
-            if (gsl_fcmp((*this->_val_gen)(), gsl_sf_exp((next->robustness() -
-                rf_net->robustness()) /
-                (this->_robust_parameters->robust_factor() *
-                (1 - rf_net->robustness()))), GSL_EPSILON) < 0)
+        // small probability of accepting change anyway to avoid local minima
+        return gsl_fcmp((*this->_val_gen)(), gsl_sf_exp((next->robustness() -
+            rf_net->robustness()) /
+            (this->_robust_parameters->robust_factor() *
+            (1 - rf_net->robustness()))), GSL_EPSILON) < 0;
+    }
+    // flow error is larger than threshold: not functional yet
+    if (gsl_fcmp(next->flow_error(), rf_net->flow_error(), GSL_EPSILON) < 0)
+    {
+        // flow error is smaller than old one
+        return true;
+    }
+    // small probability of accepting change anyway to avoid local minima
+    return gsl_fcmp((*this->_val_gen)(), gsl_sf_exp((rf_net->flow_error() -
+        next->flow_error()) / (this->_parameters->annealing_factor() *
+        rf_net->flow_error())), GSL_EPSILON) < 0;
+}
+
+/*
+ * One evolutionary step with several mutated networks, see
+ * 'Evolution::population_step'. Once the network is functional the best
+ * candidate is the most robust functional one.
+ */
+bool
+rfn::RobustEvolution::population_step(
+    rfn::RobustFunctionalNetwork* const rf_net)
+{
+    const unsigned num = this->_parameters->candidates();
+    std::vector<rfn::FlowDistributionNetwork*>& next = rf_net->population(num);
+    rfn::RobustFunctionalNetwork* candidate = NULL;
+    unsigned k = 0u;
+    for (k = 0; k < num; ++k) {
+        candidate = static_cast<rfn::RobustFunctionalNetwork*>(next[k]);
+        {
+            rfn::Profile::Scope scope(rfn::Profile::mutate);
+            candidate->mutate();
+        }
+        candidate->prepare_robustness();
+    }
+    this->evaluate_candidates(next);
+    unsigned chosen = num;
+    if (this->_parameters->selection() == rfn::best_candidate) {
+        const bool functional = gsl_fcmp(rf_net->flow_error(),
+            this->_parameters->error_threshold(), GSL_EPSILON) < 0;
+        unsigned best = num;
+        for (k = 0; k < num; ++k) {
+            candidate = static_cast<rfn::RobustFunctionalNetwork*>(next[k]);
+            if (functional) {
+                if (gsl_fcmp(candidate->flow_error(),
+                    this->_parameters->error_threshold(), GSL_EPSILON) < 0
+                    && (best == num || gsl_fcmp(candidate->robustness(),
+                    static_cast<rfn::RobustFunctionalNetwork*>(next[best])->
+                    robustness(), GSL_EPSILON) > 0))
+                {
+                    best = k;
+                }
+            }
+            else if (best == num || gsl_fcmp(candidate->flow_error(),
+                next[best]->flow_error(), GSL_EPSILON) < 0)
             {
-                *rf_net = *next;
+                best = k;
             }
         }
-    }
-    else {
-        // flow error is larger than threshold: not functional yet
-        if (gsl_fcmp(next->flow_error(), rf_net->flow_error(), GSL_EPSILON) < 0)
+        if (best < num && this->accept(rf_net,
+            static_cast<rfn::RobustFunctionalNetwork*>(next[best])))
         {
-            // flow error is smaller than old one
-            *rf_net = *next;
+            chosen = best;
         }
-        else {
-            // small probability of accepting change anyway to avoid local minima
-            if (gsl_fcmp((*this->_val_gen)(), gsl_sf_exp((rf_net->flow_error() -
-                next->flow_error()) / (this->_parameters->annealing_factor() *
-                rf_net->flow_error())), GSL_EPSILON) < 0)
+    }
+    else {
+        for (k = 0; k < num; ++k) {
+            if (this->accept(rf_net,
+                static_cast<rfn::RobustFunctionalNetwork*>(next[k])))
             {
-                *rf_net = *next;
+                chosen = k;
+                break;
             }
         }
     }
-    delete next;
+    if (chosen < num) {
+        rf_net->exchange(*next[chosen]);
+    }
+    rfn::Profile::step(chosen < num);
+    return chosen < num;
+}
+
+/*
+ * Robustness is only needed for functional candidates.
+ */
+void
+rfn::RobustEvolution::evaluate(rfn::FlowDistributionNetwork* const f_net)
+{
+    rfn::RobustFunctionalNetwork* const rf_net = static_cast
+        <rfn::RobustFunctionalNetwork*>(f_net);
+    if (gsl_fcmp(rf_net->flow_error(), this->_parameters->error_threshold(),
+        GSL_EPSILON) < 0)
+    {
+        rf_net->robustness();
+    }
+}
+
+
+/*******************************************************************************
+ * Internal Functions
+ ******************************************************************************/
+
+
+/*
+ * The annealing criterion accepts a mutated network with probability
+ * exp((r' - r) / (f (1 - r))). Drawing the uniform number first, this is the
+ * same as accepting it if its robustness r' exceeds the returned bound, which
+ * lets the mutated network decide with as few noise realisations as possible.
+ */
+double
+rfn::RobustEvolution::acceptance_bound(const double robustness)
+{
+    const double u = (*this->_val_gen)();
+    if (u == 0.0) {
+        // accept any change
+        return -1.0;
+    }
+    return robustness + this->_robust_parameters->robust_factor()
+        * (1.0 - robustness) * gsl_sf_log(u);
+}
+
+
+void
+rfn::RobustEvolution::write_checkpoint(rfn::BinaryWriter& out,
+    rfn::FlowDistributionNetwork* const f_net)
+{
+    rfn::Evolution::write_checkpoint(out, f_net);
+    out.put_u16(this->_intermediate);
+}
+
+void
+rfn::RobustEvolution::read_checkpoint(rfn::BinaryReader& in,
+    rfn::FlowDistributionNetwork* const f_net)
+{
+    rfn::Evolution::read_checkpoint(in, f_net);
+    this->_intermediate = (in.get_u16() != 0u);
 }
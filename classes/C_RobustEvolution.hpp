@@ -39,6 +39,8 @@ namespace rfn {
     protected:
         /* Data Members */
         RobustParameterManager* _robust_parameters;
+        // whether the intermediate state has yet to be written
+        bool _intermediate;
 
     public:
         /* Member Functions */
@@ -46,8 +48,20 @@ namespace rfn {
 
     protected:
         /* Internal Functions */
-        // perform one evolutionary step
-        void step(RobustFunctionalNetwork* const rf_net);
+        // perform one evolutionary step, returns whether 'rf_net' changed
+        bool step(RobustFunctionalNetwork* const rf_net);
+        // whether to replace 'rf_net' by the mutated network 'next'
+        bool accept(RobustFunctionalNetwork* const rf_net,
+            RobustFunctionalNetwork* const next);
+        // perform one evolutionary step with several mutated networks
+        bool population_step(RobustFunctionalNetwork* const rf_net);
+        virtual void evaluate(FlowDistributionNetwork* const f_net);
+        // robustness a mutated network must exceed to be accepted
+        double acceptance_bound(const double robustness);
+        virtual void write_checkpoint(BinaryWriter& out,
+            FlowDistributionNetwork* const f_net);
+        virtual void read_checkpoint(BinaryReader& in,
+            FlowDistributionNetwork* const f_net);
         
     };
 }
@@ -19,6 +19,7 @@
 
 // project
 #include "C_RobustFunctionalNetwork.hpp"
+#include "C_Profile.hpp"
 
 
 /*******************************************************************************
@@ -158,22 +159,71 @@ rfn::RobustFunctionalNetwork::operator=(RobustFunctionalNetwork& a)
 
 
 void
-rfn::RobustFunctionalNetwork::write_to_binary_stream(bfsys::ofstream& out,
+rfn::RobustFunctionalNetwork::copy(const rfn::FlowDistributionNetwork& c)
+{
+    if (this != &c) {
+        rfn::FlowDistributionNetwork::copy(c);
+        // cast to this class from possibly derived classes
+        const rfn::RobustFunctionalNetwork& b = static_cast
+            <const RobustFunctionalNetwork&>(c);
+        this->_robust_changed = b._robust_changed;
+        this->_robustness = b._robustness;
+        this->_robust_parameters = b._robust_parameters;
+    }
+}
+
+void
+rfn::RobustFunctionalNetwork::exchange(rfn::FlowDistributionNetwork& a)
+{
+    if (this != &a) {
+        rfn::FlowDistributionNetwork::exchange(a);
+        // cast to this class from possibly derived classes
+        rfn::RobustFunctionalNetwork& b = static_cast
+            <RobustFunctionalNetwork&>(a);
+        this->_robust_changed = b._robust_changed;
+        this->_robustness = b._robustness;
+    }
+}
+
+void
+rfn::RobustFunctionalNetwork::write_to_binary_stream(rfn::BinaryWriter& out,
     const unsigned long iteration)
 {
     rfn::FlowDistributionNetwork::write_to_binary_stream(out, iteration);
-    out.write((char*)&this->_robustness, sizeof(double));
+    out.put_f64(this->_robustness);
+}
+
+void
+rfn::RobustFunctionalNetwork::write_to_record(rfn::Archive::Record& record)
+{
+    rfn::FlowDistributionNetwork::write_to_record(record);
+    record.robustness = this->_robustness;
 }
 
 unsigned long
-rfn::RobustFunctionalNetwork::read_from_binary_stream(bfsys::ifstream& in)
+rfn::RobustFunctionalNetwork::read_from_binary_stream(rfn::BinaryReader& in)
 {
     unsigned long iteration = 0L;
     iteration = rfn::FlowDistributionNetwork::read_from_binary_stream(in);
-    in.read((char*)&this->_robustness, sizeof(double));
+    this->_robustness = in.get_f64();
     return iteration;
 }
 
+void
+rfn::RobustFunctionalNetwork::write_checkpoint(rfn::BinaryWriter& out,
+    const unsigned long iteration)
+{
+    rfn::FlowDistributionNetwork::write_checkpoint(out, iteration);
+    out.put_u16(this->_robust_changed);
+}
+
+void
+rfn::RobustFunctionalNetwork::read_checkpoint(rfn::BinaryReader& in)
+{
+    rfn::FlowDistributionNetwork::read_checkpoint(in);
+    this->_robust_changed = (in.get_u16() != 0u);
+}
+
 double
 rfn::RobustFunctionalNetwork::robustness()
 {
@@ -182,6 +232,7 @@ rfn::RobustFunctionalNetwork::robustness()
             this->_robust_parameters->robust_threshold(), GSL_EPSILON) < 0)
         {
             // flow error is below threshold, i.e., robustness is relevant
+            rfn::Profile::Scope scope(rfn::Profile::robustness);
             this->compute_robustness();
         }
         else {
@@ -192,3 +243,10 @@ rfn::RobustFunctionalNetwork::robustness()
     }
     return this->_robustness;
 }
+
+bool
+rfn::RobustFunctionalNetwork::robustness_exceeds(const double bound)
+{
+    return gsl_fcmp(this->robustness(), bound, GSL_EPSILON) > 0;
+}
+
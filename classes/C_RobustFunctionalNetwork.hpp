@@ -53,20 +53,35 @@ namespace rfn {
         RobustFunctionalNetwork& operator=(RobustFunctionalNetwork& a);
 
         /* Member Functions */
+        virtual void copy(const FlowDistributionNetwork& c);
+        virtual void exchange(FlowDistributionNetwork& a);
         // save this object to a binary stream
-        virtual void write_to_binary_stream(bfsys::ofstream& out,
+        virtual void write_to_binary_stream(BinaryWriter& out,
             const unsigned long iteration);
+        // state of this object as an archive record
+        virtual void write_to_record(Archive::Record& record);
         // read this object from a binary stream
-        virtual unsigned long read_from_binary_stream(bfsys::ifstream& in);
+        virtual unsigned long read_from_binary_stream(BinaryReader& in);
+        virtual void write_checkpoint(BinaryWriter& out,
+            const unsigned long iteration);
+        virtual void read_checkpoint(BinaryReader& in);
         // change the network
         virtual void mutate()
         {
             this->_changed = true;
             this->_robust_changed = true;
             this->_mutation->mutate(this->_network);
+            this->track_mutation();
         }
         // get and if necessary compute robustness
         double robustness();
+        // whether robustness is greater than 'bound', robustness need only be
+        // computed in full if it is
+        virtual bool robustness_exceeds(const double bound);
+        // draw what computing the robustness requires from the shared random
+        // number generator in advance, so that it may be done in another thread
+        virtual void prepare_robustness()
+        {}
         // removes unused nodes
         virtual void prune()
         {
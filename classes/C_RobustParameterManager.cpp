@@ -30,7 +30,8 @@ rfn::RobustParameterManager::RobustParameterManager():
     ParameterManager(),
     _min_robustness(0.0),
     _robust_threshold(0.0),
-    _robust_factor(0.0)
+    _robust_factor(0.0),
+    _confidence(0.0)
 {}
 
 /*
@@ -46,19 +47,32 @@ rfn::RobustParameterManager::~RobustParameterManager()
 
 
 void
-rfn::RobustParameterManager::write_to_binary_stream(bfsys::ofstream& out)
+rfn::RobustParameterManager::write_to_binary_stream(rfn::BinaryWriter& out)
 {
     rfn::ParameterManager::write_to_binary_stream(out);
-    out.write((char*)&this->_min_robustness, sizeof(double));
-    out.write((char*)&this->_robust_threshold, sizeof(double));
-    out.write((char*)&this->_robust_factor, sizeof(double));
+    out.put_f64(this->_min_robustness);
+    out.put_f64(this->_robust_threshold);
+    out.put_f64(this->_robust_factor);
 }
 
 void
-rfn::RobustParameterManager::read_from_binary_stream(bfsys::ifstream& in)
+rfn::RobustParameterManager::read_from_binary_stream(rfn::BinaryReader& in)
 {
     rfn::ParameterManager::read_from_binary_stream(in);
-    in.read((char*)&this->_min_robustness, sizeof(double));
-    in.read((char*)&this->_robust_threshold, sizeof(double));
-    in.read((char*)&this->_robust_factor, sizeof(double));
+    this->_min_robustness = in.get_f64();
+    this->_robust_threshold = in.get_f64();
+    this->_robust_factor = in.get_f64();
 }
+
+void
+rfn::RobustParameterManager::assign(rfn::ParameterManager const* const other)
+{
+    rfn::ParameterManager::assign(other);
+    rfn::RobustParameterManager const* const b = static_cast
+        <rfn::RobustParameterManager const*>(other);
+    this->_min_robustness = b->_min_robustness;
+    this->_robust_threshold = b->_robust_threshold;
+    this->_robust_factor = b->_robust_factor;
+    this->_confidence = b->_confidence;
+}
+
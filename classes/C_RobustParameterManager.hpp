@@ -38,13 +38,18 @@ namespace rfn {
         double _min_robustness;
         double _robust_threshold;
         double _robust_factor;
+        // confidence at which a sampled robustness may decide acceptance
+        // early, zero always computes the robustness in full
+        double _confidence;
 
     public:
         /* Member Functions */
         // save this object to a binary stream
-        virtual void write_to_binary_stream(bfsys::ofstream& out);
+        virtual void write_to_binary_stream(BinaryWriter& out);
         // read this object from a binary stream
-        virtual void read_from_binary_stream(bfsys::ifstream& in);
+        virtual void read_from_binary_stream(BinaryReader& in);
+        // take over all parameters of another instance of the same type
+        virtual void assign(ParameterManager const* const other);
         // _min_robustness get method
         double min_robustness() const
         {
@@ -75,6 +80,16 @@ namespace rfn {
         {
             this->_robust_factor = f;
         }
+        // _confidence get method
+        double confidence() const
+        {
+            return this->_confidence;
+        }
+        // _confidence set method
+        void confidence(const double c)
+        {
+            this->_confidence = c;
+        }
 
     }; // class RobustParameterManager
 
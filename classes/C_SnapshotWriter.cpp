@@ -0,0 +1,244 @@
+/*******************************************************************************
+ * filename:    C_SnapshotWriter.cpp
+ * description: Implementation of 'SnapshotWriter' class
+ * author:      agent
+ * created:     2026-10-17
+ * copyright:   Jacobs University Bremen. All rights reserved.
+ ******************************************************************************/
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+
+// std
+#include <iostream>
+#include <algorithm>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+
+// boost
+#include <boost/bind/bind.hpp>
+
+// project
+#include "C_SnapshotWriter.hpp"
+#include "C_Profile.hpp"
+
+
+/*******************************************************************************
+ * Constructors & Destructor
+ ******************************************************************************/
+
+
+rfn::SnapshotWriter::SnapshotWriter():
+    _queue(),
+    _queued(0u),
+    _stopping(false),
+    _lock(),
+    _not_empty(),
+    _not_full(),
+    _thread(),
+    _unsynced()
+{
+    this->_thread = boost::thread(boost::bind(&rfn::SnapshotWriter::work,
+        this));
+}
+
+/*
+ * Destructor
+ */
+rfn::SnapshotWriter::~SnapshotWriter()
+{
+    {
+        boost::mutex::scoped_lock guard(this->_lock);
+        this->_stopping = true;
+    }
+    this->_not_empty.notify_one();
+    this->_thread.join();
+}
+
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+
+
+void
+rfn::SnapshotWriter::push(const rfn::SnapshotWriter::Action action,
+    const std::string& path, const std::string& data)
+{
+    Job* const job = new Job();
+    CHECK_CRITICAL_POINTER(job);
+    job->action = action;
+    job->path = path;
+    job->data = data;
+    job->archive = NULL;
+    this->enqueue(job, data.size());
+}
+
+void
+rfn::SnapshotWriter::push(rfn::Archive& archive,
+    const rfn::Archive::Record& record)
+{
+    Job* const job = new Job();
+    CHECK_CRITICAL_POINTER(job);
+    job->archive = &archive;
+    job->record = record;
+    this->enqueue(job, (record.degrees.size() + record.targets.size()) *
+        sizeof(unsigned));
+}
+
+/*
+ * Failures are reported rather than thrown, they must not end the writer
+ * thread. A replaced file is renamed to its previous version before the new
+ * one takes its place, thus at any time one of both is complete.
+ */
+void
+rfn::SnapshotWriter::apply(const rfn::SnapshotWriter::Action action,
+    const std::string& path, const std::string& data)
+{
+    boost::system::error_code error;
+    if (action == remove_file) {
+        bfsys::remove(path, error);
+        if (error) {
+            std::cerr << "Warning: Cannot remove '" << path << "'."
+                << std::endl;
+        }
+        bfsys::remove(previous(path), error);
+        return;
+    }
+    if (action == write_file) {
+        if (!write_synced(path, data)) {
+            std::cerr << "Warning: Cannot write '" << path << "'."
+                << std::endl;
+        }
+        return;
+    }
+    const std::string target = path + ".tmp";
+    if (!write_synced(target, data)) {
+        std::cerr << "Warning: Cannot write '" << target << "'." << std::endl;
+        return;
+    }
+    if (bfsys::exists(path, error)) {
+        bfsys::rename(path, previous(path), error);
+        if (error) {
+            std::cerr << "Warning: Cannot keep '" << path << "'." << std::endl;
+        }
+    }
+    bfsys::rename(target, path, error);
+    if (error) {
+        std::cerr << "Warning: Cannot replace '" << path << "'."
+            << std::endl;
+    }
+    sync_directory(path);
+}
+
+
+/*******************************************************************************
+ * Internal Functions
+ ******************************************************************************/
+
+
+/*
+ * A job larger than the capacity is accepted once the queue is empty.
+ */
+void
+rfn::SnapshotWriter::enqueue(rfn::SnapshotWriter::Job* const job,
+    const size_t size)
+{
+    rfn::Profile::Scope scope(rfn::Profile::io);
+    boost::mutex::scoped_lock guard(this->_lock);
+    while (this->_queued > 0u && this->_queued + size > CAPACITY) {
+        this->_not_full.wait(guard);
+    }
+    this->_queue.push_back(job);
+    this->_queued += size;
+    this->_not_empty.notify_one();
+}
+
+bool
+rfn::SnapshotWriter::write_synced(const std::string& path,
+    const std::string& data)
+{
+    const int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        return false;
+    }
+    size_t first = 0;
+    ssize_t written = 0;
+    while (first < data.size()) {
+        written = ::write(fd, data.data() + first, data.size() - first);
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+        if (written <= 0) {
+            break;
+        }
+        first += (size_t)written;
+    }
+    const bool synced = (first == data.size() && ::fsync(fd) == 0);
+    return (::close(fd) == 0) && synced;
+}
+
+void
+rfn::SnapshotWriter::sync_directory(const std::string& path)
+{
+    std::string dir = bfsys::path(path).parent_path().string();
+    if (dir.empty()) {
+        dir = ".";
+    }
+    const int fd = ::open(dir.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return;
+    }
+    ::fsync(fd);
+    ::close(fd);
+}
+
+void
+rfn::SnapshotWriter::work()
+{
+    Job* job = NULL;
+    size_t size = 0u;
+    while (true) {
+        {
+            boost::mutex::scoped_lock guard(this->_lock);
+            while (this->_queue.empty() && !this->_stopping) {
+                this->_not_empty.wait(guard);
+            }
+            if (this->_queue.empty()) {
+                break;
+            }
+            job = this->_queue.front();
+            this->_queue.pop_front();
+        }
+        if (job->archive != NULL) {
+            job->archive->append(job->record);
+            if (std::find(this->_unsynced.begin(), this->_unsynced.end(),
+                job->archive) == this->_unsynced.end())
+            {
+                this->_unsynced.push_back(job->archive);
+            }
+            size = (job->record.degrees.size() + job->record.targets.size()) *
+                sizeof(unsigned);
+        }
+        else {
+            if (job->action == replace_file) {
+                for (size_t k = 0; k < this->_unsynced.size(); ++k) {
+                    this->_unsynced[k]->sync();
+                }
+                this->_unsynced.clear();
+            }
+            apply(job->action, job->path, job->data);
+            size = job->data.size();
+        }
+        delete job;
+        {
+            boost::mutex::scoped_lock guard(this->_lock);
+            this->_queued -= size;
+        }
+        this->_not_full.notify_all();
+    }
+}
@@ -0,0 +1,134 @@
+/*******************************************************************************
+ * filename:    C_SnapshotWriter.hpp
+ * description: Background thread writing the states of running evolutions
+ * author:      agent
+ * created:     2026-10-17
+ * copyright:   Jacobs University Bremen. All rights reserved.
+ *******************************************************************************
+ * Snapshots, intermediate and final states are serialised by the evolution
+ * that takes them and handed to a single writer thread per process, which
+ * writes them to their files or appends them to the archive in the order they
+ * were handed over. At most 'CAPACITY' bytes wait in the queue, an evolution
+ * that hands over more waits until the writer has caught up, thus memory
+ * stays flat however many snapshots are taken. All states have been written
+ * once the writer is destroyed. Every file is flushed to the disk once it has
+ * been written, the archives that received records before a checkpoint are
+ * flushed before it. Checkpoints replace their file only once they have been
+ * written in full and flushed to the disk, and the directory is flushed after
+ * the replacement, thus a checkpoint on disk is complete and all that was
+ * handed over before it is on disk as well. The checkpoint it replaces is kept
+ * as '<path>.previous' in case the node fails before the new one has reached
+ * the disk.
+ ******************************************************************************/
+
+
+#ifndef _C_SNAPSHOTWRITER_HPP
+#define	_C_SNAPSHOTWRITER_HPP
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+
+// std
+#include <string>
+#include <deque>
+#include <vector>
+
+// boost
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+
+// project
+#include "common_definitions.hpp"
+#include "C_Archive.hpp"
+
+
+/*******************************************************************************
+ * Declarations
+ ******************************************************************************/
+
+
+namespace rfn {
+
+    class SnapshotWriter {
+
+    public:
+        // upper bound of queued bytes
+        static const size_t CAPACITY = 16777216u;
+        // what to do with a file
+        enum Action {
+            write_file,
+            // write a temporary file to the disk that then replaces the file,
+            // which is kept as its previous version
+            replace_file,
+            // remove the file and its previous version
+            remove_file
+        };
+
+    protected:
+        // a file or an archive record to be written
+        struct Job {
+            Action action;
+            std::string path;
+            std::string data;
+            Archive* archive;
+            Archive::Record record;
+        };
+
+        /* Data Members */
+        std::deque<Job*> _queue;
+        size_t _queued;
+        bool _stopping;
+        boost::mutex _lock;
+        boost::condition_variable _not_empty;
+        boost::condition_variable _not_full;
+        boost::thread _thread;
+        // archives with records that may not be on the disk yet, only used by
+        // the writer thread
+        std::vector<Archive*> _unsynced;
+
+    public:
+        /* Constructors & Destructor */
+        // starts the writer thread
+        SnapshotWriter();
+        // writes all queued states
+        ~SnapshotWriter();
+
+        /* Member Functions */
+        // 'action' on the file 'path', e.g., write 'data' to it
+        void push(const Action action, const std::string& path,
+            const std::string& data);
+        // append 'record' to 'archive'
+        void push(Archive& archive, const Archive::Record& record);
+        // 'action' on the file 'path' right away, without flushing archives
+        static void apply(const Action action, const std::string& path,
+            const std::string& data);
+        // where 'replace_file' keeps the previous version of 'path'
+        static std::string previous(const std::string& path)
+        {
+            return path + ".previous";
+        }
+
+    protected:
+        /* Internal Functions */
+        void enqueue(Job* const job, const size_t size);
+        // write 'data' to 'path' and wait until it is on the disk
+        static bool write_synced(const std::string& path,
+            const std::string& data);
+        // wait until the entries of the directory of 'path' are on the disk
+        static void sync_directory(const std::string& path);
+        // main loop of the writer thread
+        void work();
+
+    private:
+        SnapshotWriter(const SnapshotWriter&);
+        SnapshotWriter& operator=(const SnapshotWriter&);
+    };
+
+} // namespace rfn
+
+
+#endif // _C_SNAPSHOTWRITER_HPP
@@ -0,0 +1,361 @@
+/*******************************************************************************
+ * filename:    C_SparseLU.cpp
+ * description: Implementation of 'SparseLU' class
+ * author:      agent
+ * created:     2026-10-17
+ * copyright:   Jacobs University Bremen. All rights reserved.
+ *******************************************************************************
+ * The factorisation is a left-looking (Gilbert-Peierls) LU decomposition: the
+ * non-zero pattern of each column is found by a depth first search in the
+ * graph of the lower factor computed so far, such that the work is
+ * proportional to the number of floating point operations.
+ ******************************************************************************/
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+
+// std
+#include <algorithm>
+
+// gsl
+#include <gsl/gsl_errno.h>
+
+// project
+#include "C_SparseLU.hpp"
+
+
+/*******************************************************************************
+ * Constructors & Destructor
+ ******************************************************************************/
+
+
+/*
+ * Default constructor
+ */
+rfn::SparseLU::SparseLU():
+    _size(0u),
+    _local(),
+    _col_ptr(),
+    _row_ind(),
+    _values(),
+    _perm(),
+    _inv_perm(),
+    _l_ptr(),
+    _l_ind(),
+    _l_val(),
+    _u_ptr(),
+    _u_ind(),
+    _u_val(),
+    _work(),
+    _stack(),
+    _reach(),
+    _next(),
+    _mark(),
+    _rows(),
+    _degree(),
+    _eliminated()
+{}
+
+/*
+ * Destructor
+ */
+rfn::SparseLU::~SparseLU()
+{}
+
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+
+
+/*
+ * Column 'j' of the SLE consists of the unit diagonal and -1 / out-degree('j')
+ * for every target of 'j', i.e., the outgoing edges of a node are exactly the
+ * non-zero elements of its column. Edges leaving the set of 'nodes' are
+ * dropped.
+ */
+void
+rfn::SparseLU::assemble(rfn::Adjacency const* const network,
+    unsigned const* const nodes, const unsigned size)
+{
+    this->_size = size;
+    this->_local.assign(network->num_vertices(), size);
+    for (unsigned j = 0; j < size; ++j) {
+        this->_local[nodes[j]] = j;
+    }
+    this->_col_ptr.assign(size + 1, 0u);
+    this->_row_ind.clear();
+    this->_values.clear();
+    rfn::Adjacency::Iterator oeit, oeit_end;
+    unsigned i = 0u;
+    double weight = 0.0;
+    for (unsigned j = 0; j < size; ++j) {
+        this->_row_ind.push_back(j);
+        this->_values.push_back(1.0);
+        weight = -1.0 / (double)network->out_degree(nodes[j]);
+        for (boost::tie(oeit, oeit_end) = network->out_neighbours(nodes[j]);
+            oeit != oeit_end; ++oeit)
+        {
+            i = this->_local[*oeit];
+            if (i < size) {
+                this->_row_ind.push_back(i);
+                this->_values.push_back(weight);
+            }
+        }
+        this->_col_ptr[j + 1] = (unsigned)this->_row_ind.size();
+    }
+}
+
+/*
+ * Factorise P * A * P^T = L * U where P is the fill-reducing permutation.
+ */
+int
+rfn::SparseLU::decompose()
+{
+    const unsigned n = this->_size;
+    this->order();
+    this->_l_ptr.assign(n + 1, 0u);
+    this->_l_ind.clear();
+    this->_l_val.clear();
+    this->_u_ptr.assign(n + 1, 0u);
+    this->_u_ind.clear();
+    this->_u_val.clear();
+    this->_work.assign(n, 0.0);
+    this->_stack.resize(n);
+    this->_reach.resize(n);
+    this->_next.resize(n);
+    this->_mark.assign(n, -1);
+    unsigned top = 0u;
+    unsigned i = 0u;
+    unsigned j = 0u;
+    unsigned p = 0u;
+    unsigned t = 0u;
+    double x_j = 0.0;
+    double pivot = 0.0;
+    for (unsigned k = 0; k < n; ++k) {
+        // non-zero pattern of column 'k' of L \ A(:, k) in topological order
+        top = this->reach(k);
+        // scatter the permuted column into the dense work vector
+        j = this->_perm[k];
+        for (p = this->_col_ptr[j]; p < this->_col_ptr[j + 1]; ++p) {
+            this->_work[this->_inv_perm[this->_row_ind[p]]] = this->_values[p];
+        }
+        // sparse triangular solve with the columns of L computed so far
+        for (t = top; t < n; ++t) {
+            j = this->_reach[t];
+            if (j >= k) {
+                continue;
+            }
+            x_j = this->_work[j];
+            for (p = this->_l_ptr[j]; p < this->_l_ptr[j + 1]; ++p) {
+                this->_work[this->_l_ind[p]] -= this->_l_val[p] * x_j;
+            }
+        }
+        pivot = this->_work[k];
+        if (pivot == 0.0) {
+            // column dominance implies this only happens for singular matrices
+            for (t = top; t < n; ++t) {
+                this->_work[this->_reach[t]] = 0.0;
+            }
+            return GSL_ESING;
+        }
+        // gather U(:, k) and L(:, k)
+        for (t = top; t < n; ++t) {
+            i = this->_reach[t];
+            if (i < k) {
+                this->_u_ind.push_back(i);
+                this->_u_val.push_back(this->_work[i]);
+            }
+            else if (i > k) {
+                this->_l_ind.push_back(i);
+                this->_l_val.push_back(this->_work[i] / pivot);
+            }
+            this->_work[i] = 0.0;
+        }
+        this->_u_ind.push_back(k);
+        this->_u_val.push_back(pivot);
+        this->_l_ptr[k + 1] = (unsigned)this->_l_ind.size();
+        this->_u_ptr[k + 1] = (unsigned)this->_u_ind.size();
+    }
+    return GSL_SUCCESS;
+}
+
+/*
+ * Solve A * x = b where 'x' holds 'b' on entry.
+ */
+int
+rfn::SparseLU::solve(gsl_vector* const x)
+{
+    const unsigned n = this->_size;
+    if (x->size != n) {
+        return GSL_EBADLEN;
+    }
+    unsigned i = 0u;
+    unsigned p = 0u;
+    double x_j = 0.0;
+    for (i = 0; i < n; ++i) {
+        this->_work[i] = x->data[this->_perm[i] * x->stride];
+    }
+    // forward substitution with unit lower triangular L
+    for (unsigned j = 0; j < n; ++j) {
+        x_j = this->_work[j];
+        if (x_j == 0.0) {
+            continue;
+        }
+        for (p = this->_l_ptr[j]; p < this->_l_ptr[j + 1]; ++p) {
+            this->_work[this->_l_ind[p]] -= this->_l_val[p] * x_j;
+        }
+    }
+    // backward substitution with U, the diagonal is the last column entry
+    for (unsigned j = n; j-- > 0;) {
+        p = this->_u_ptr[j + 1] - 1;
+        this->_work[j] /= this->_u_val[p];
+        x_j = this->_work[j];
+        if (x_j == 0.0) {
+            continue;
+        }
+        for (p = this->_u_ptr[j]; p < this->_u_ptr[j + 1] - 1; ++p) {
+            this->_work[this->_u_ind[p]] -= this->_u_val[p] * x_j;
+        }
+    }
+    for (i = 0; i < n; ++i) {
+        x->data[this->_perm[i] * x->stride] = this->_work[i];
+        this->_work[i] = 0.0;
+    }
+    return GSL_SUCCESS;
+}
+
+
+/*******************************************************************************
+ * Internal Functions
+ ******************************************************************************/
+
+
+/*
+ * Minimum degree ordering on the pattern of A + A^T. The elimination graph is
+ * kept explicitly as one bit row per node which is cheap for the network sizes
+ * we deal with and avoids the setup cost of a quotient graph.
+ */
+void
+rfn::SparseLU::order()
+{
+    const unsigned bits = sizeof(Word) * 8u;
+    const unsigned n = this->_size;
+    const unsigned words = (n + bits - 1u) / bits;
+    this->_rows.assign(n * words, 0ul);
+    this->_degree.assign(n, 0u);
+    this->_eliminated.assign(n, false);
+    std::vector<Word>& rows = this->_rows;
+    Indices& degree = this->_degree;
+    std::vector<bool>& eliminated = this->_eliminated;
+    unsigned i = 0u;
+    unsigned j = 0u;
+    unsigned w = 0u;
+    // symmetric pattern without the diagonal
+    for (j = 0; j < n; ++j) {
+        for (unsigned p = this->_col_ptr[j]; p < this->_col_ptr[j + 1]; ++p) {
+            i = this->_row_ind[p];
+            if (i != j) {
+                rows[i * words + j / bits] |= 1ul << (j % bits);
+                rows[j * words + i / bits] |= 1ul << (i % bits);
+            }
+        }
+    }
+    for (i = 0; i < n; ++i) {
+        for (w = 0; w < words; ++w) {
+            degree[i] += (unsigned)__builtin_popcountl(rows[i * words + w]);
+        }
+    }
+    this->_perm.resize(n);
+    this->_inv_perm.resize(n);
+    unsigned v = 0u;
+    unsigned u = 0u;
+    Word word = 0ul;
+    for (unsigned k = 0; k < n; ++k) {
+        // pick the remaining node of minimum degree
+        v = n;
+        for (i = 0; i < n; ++i) {
+            if (!eliminated[i] && (v == n || degree[i] < degree[v])) {
+                v = i;
+            }
+        }
+        this->_perm[k] = v;
+        this->_inv_perm[v] = k;
+        eliminated[v] = true;
+        // eliminating 'v' turns its neighbourhood into a clique
+        for (w = 0; w < words; ++w) {
+            word = rows[v * words + w];
+            while (word != 0ul) {
+                u = w * bits + (unsigned)__builtin_ctzl(word);
+                word &= word - 1ul;
+                degree[u] = 0u;
+                for (j = 0; j < words; ++j) {
+                    rows[u * words + j] |= rows[v * words + j];
+                }
+                rows[u * words + u / bits] &= ~(1ul << (u % bits));
+                rows[u * words + v / bits] &= ~(1ul << (v % bits));
+                for (j = 0; j < words; ++j) {
+                    degree[u] += (unsigned)__builtin_popcountl(
+                        rows[u * words + j]);
+                }
+            }
+        }
+    }
+}
+
+/*
+ * Depth first search from all non-zero elements of column 'k' in the graph of
+ * L. On return '_reach[top, n)' contains the non-zero pattern of the solution
+ * in topological order.
+ */
+unsigned
+rfn::SparseLU::reach(const unsigned k)
+{
+    const unsigned n = this->_size;
+    const int stamp = (int)k;
+    const unsigned column = this->_perm[k];
+    unsigned top = n;
+    unsigned j = 0u;
+    unsigned end = 0u;
+    unsigned p = 0u;
+    unsigned i = 0u;
+    int head = 0;
+    bool done = false;
+    for (unsigned q = this->_col_ptr[column]; q < this->_col_ptr[column + 1];
+        ++q)
+    {
+        i = this->_inv_perm[this->_row_ind[q]];
+        if (this->_mark[i] == stamp) {
+            continue;
+        }
+        head = 0;
+        this->_stack[0] = i;
+        while (head >= 0) {
+            j = this->_stack[head];
+            // only columns left of 'k' have been factorised
+            end = (j < k) ? this->_l_ptr[j + 1] : 0u;
+            if (this->_mark[j] != stamp) {
+                this->_mark[j] = stamp;
+                this->_next[j] = (j < k) ? this->_l_ptr[j] : 0u;
+            }
+            done = true;
+            for (p = this->_next[j]; p < end; ++p) {
+                if (this->_mark[this->_l_ind[p]] != stamp) {
+                    this->_next[j] = p + 1;
+                    this->_stack[++head] = this->_l_ind[p];
+                    done = false;
+                    break;
+                }
+            }
+            if (done) {
+                --head;
+                this->_reach[--top] = j;
+            }
+        }
+    }
+    return top;
+}
+
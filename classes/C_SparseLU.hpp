@@ -0,0 +1,117 @@
+/*******************************************************************************
+ * filename:    C_SparseLU.hpp
+ * description: Sparse LU factorisation of the flow distribution SLE
+ * author:      agent
+ * created:     2026-10-17
+ * copyright:   Jacobs University Bremen. All rights reserved.
+ *******************************************************************************
+ * The system of linear equations of a flow distribution network, or of a block
+ * of it, is stored in compressed sparse column (CSC) format that is assembled
+ * directly from the outgoing edges of each node. A minimum degree ordering
+ * reduces the fill-in of the factors.
+ *
+ * The SLE matrix has a unit diagonal and every column sums to zero or one,
+ * i.e., it is column diagonally dominant. Gaussian elimination thus needs no
+ * numerical pivoting and a symmetric permutation of rows and columns suffices.
+ * A zero pivot can only occur when the matrix is singular.
+ ******************************************************************************/
+
+
+#ifndef _C_SPARSELU_HPP
+#define	_C_SPARSELU_HPP
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+
+// std
+#include <vector>
+
+// gsl
+#include <gsl/gsl_vector.h>
+
+// project
+#include "common_definitions.hpp"
+
+
+/*******************************************************************************
+ * Declarations
+ ******************************************************************************/
+
+
+namespace rfn {
+
+    class SparseLU {
+
+    protected:
+        typedef std::vector<unsigned> Indices;
+        typedef std::vector<double> Values;
+        typedef unsigned long Word;
+        /* Data Members */
+        unsigned _size;
+        // position of each network node in the system, '_size' if absent
+        Indices _local;
+        // the system in CSC format
+        Indices _col_ptr;
+        Indices _row_ind;
+        Values _values;
+        // fill-reducing ordering, '_perm[new] = old', '_inv_perm[old] = new'
+        Indices _perm;
+        Indices _inv_perm;
+        // strictly lower unit triangular factor in CSC format
+        Indices _l_ptr;
+        Indices _l_ind;
+        Values _l_val;
+        // upper triangular factor in CSC format, diagonal stored last
+        Indices _u_ptr;
+        Indices _u_ind;
+        Values _u_val;
+        // workspace
+        Values _work;
+        Indices _stack;
+        Indices _reach;
+        Indices _next;
+        std::vector<int> _mark;
+        // elimination graph of the ordering, one bit row per node
+        std::vector<Word> _rows;
+        Indices _degree;
+        std::vector<bool> _eliminated;
+
+    public:
+        /* Constructors & Destructor */
+        SparseLU();
+        virtual ~SparseLU();
+
+        /* Member Functions */
+        // build the SLE restricted to 'nodes' straight from the edges
+        void assemble(Adjacency const* const network,
+            unsigned const* const nodes, const unsigned size);
+        // compute ordering and factors, returns a gsl status
+        int decompose();
+        // solve the factorised system in place
+        int solve(gsl_vector* const x);
+        // number of unknowns
+        unsigned size() const
+        {
+            return this->_size;
+        }
+        // number of non-zero elements in both factors
+        unsigned factor_size() const
+        {
+            return (unsigned)(this->_l_val.size() + this->_u_val.size());
+        }
+
+    protected:
+        /* Internal Functions */
+        void order();
+        unsigned reach(const unsigned k);
+
+    }; // class SparseLU
+
+} // namespace rfn
+
+
+#endif	// _C_SPARSELU_HPP
+
@@ -0,0 +1,158 @@
+/*******************************************************************************
+ * filename:    C_Telemetry.cpp
+ * description: Implementation of 'Telemetry' class
+ * author:      agent
+ * created:     2026-10-17
+ * copyright:   Jacobs University Bremen. All rights reserved.
+ ******************************************************************************/
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+
+// std
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+
+// project
+#include "C_Telemetry.hpp"
+#include "C_Profile.hpp"
+
+
+/*******************************************************************************
+ * Static Data Members
+ ******************************************************************************/
+
+
+const double rfn::Telemetry::PERIOD = 1.0;
+
+
+/*******************************************************************************
+ * Constructors & Destructor
+ ******************************************************************************/
+
+
+rfn::Telemetry::Telemetry(const std::string& path, const unsigned interval):
+    _output(::open(path.c_str(), O_WRONLY | O_APPEND | O_CREAT, 0644)),
+    _buffer(),
+    _interval(std::max(1u, interval)),
+    _flushed(rfn::Profile::wall_time()),
+    _lock()
+{
+    if (this->_output < 0) {
+        std::cerr << "Warning: Cannot open '" << path
+            << "' for telemetry, records are discarded." << std::endl;
+    }
+    this->_buffer.reserve(CAPACITY);
+}
+
+/*
+ * Destructor
+ */
+rfn::Telemetry::~Telemetry()
+{
+    this->flush();
+    if (this->_output >= 0) {
+        ::close(this->_output);
+    }
+}
+
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+
+
+void
+rfn::Telemetry::write(const rfn::Telemetry::Record& record)
+{
+    std::ostringstream line;
+    line << "{\"network\":\"";
+    for (std::string::const_iterator it = record.network.begin();
+        it != record.network.end(); ++it)
+    {
+        if (*it == '"' || *it == '\\') {
+            line << '\\' << *it;
+        }
+        else if ((unsigned char)*it < 0x20) {
+            line << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                << (unsigned)(unsigned char)*it << std::dec;
+        }
+        else {
+            line << *it;
+        }
+    }
+    line << "\",\"time\":" << record.time << ",\"flow_error\":"
+        << std::setprecision(6) << record.flow_error << ",\"robustness\":";
+    if (record.robustness < 0.0) {
+        line << "null";
+    }
+    else {
+        line << record.robustness;
+    }
+    line << ",\"acceptance\":" << record.acceptance
+        << ",\"steps_per_second\":" << record.steps_per_second
+        << ",\"finished\":" << ((record.finished) ? "true" : "false")
+        << "}\n";
+    const std::string& text = line.str();
+    boost::mutex::scoped_lock guard(this->_lock);
+    if (this->_buffer.size() + text.size() > CAPACITY) {
+        this->drain();
+    }
+    this->_buffer.append(text);
+    if (record.finished || this->_buffer.size() >= CAPACITY
+        || rfn::Profile::wall_time() - this->_flushed >= PERIOD)
+    {
+        this->drain();
+    }
+}
+
+void
+rfn::Telemetry::flush()
+{
+    boost::mutex::scoped_lock guard(this->_lock);
+    this->drain();
+}
+
+
+/*******************************************************************************
+ * Internal Functions
+ ******************************************************************************/
+
+
+/*
+ * A line is written by a single call unless it is interrupted, a failed write
+ * discards the remaining records.
+ */
+void
+rfn::Telemetry::drain()
+{
+    size_t first = 0;
+    size_t last = 0;
+    ssize_t written = 0;
+    while (this->_output >= 0 && first < this->_buffer.size()) {
+        last = this->_buffer.find('\n', first);
+        last = (last == std::string::npos) ? this->_buffer.size() : last + 1;
+        while (first < last) {
+            written = ::write(this->_output, this->_buffer.data() + first,
+                last - first);
+            if (written < 0 && errno == EINTR) {
+                continue;
+            }
+            if (written <= 0) {
+                first = this->_buffer.size();
+                break;
+            }
+            first += (size_t)written;
+        }
+    }
+    this->_buffer.clear();
+    this->_flushed = rfn::Profile::wall_time();
+}
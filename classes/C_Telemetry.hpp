@@ -0,0 +1,112 @@
+/*******************************************************************************
+ * filename:    C_Telemetry.hpp
+ * description: Machine readable progress records of running evolutions
+ * author:      agent
+ * created:     2026-10-17
+ * copyright:   Jacobs University Bremen. All rights reserved.
+ *******************************************************************************
+ * With '--telemetry <file>' every evolution appends a record of its progress
+ * every 'telemetry_interval()' steps and one when it is finished. Records are
+ * JSON objects, one per line, e.g.,
+ *
+ *  {"network":"run/net","time":2000,"flow_error":0.0132,"robustness":null,
+ *   "acceptance":0.214,"steps_per_second":1840.5,"finished":false}
+ *
+ * where 'acceptance' and 'steps_per_second' refer to the steps since the
+ * previous record and 'robustness' is null for flow evolution.
+ *
+ * All evolutions of a process share one channel. Records are collected in a
+ * buffer of at most 'CAPACITY' bytes that is written out once it is full or at
+ * least 'PERIOD' seconds after the last write. The file is opened for
+ * appending and every line is written by a single 'write', thus several
+ * processes may share a regular file. '/dev/stdout' or '/dev/fd/<n>' stream to
+ * a pipe, which keeps the lines of several processes apart only as long as
+ * they are no longer than PIPE_BUF, i.e., for network names of a few thousand
+ * characters at most.
+ ******************************************************************************/
+
+
+#ifndef _C_TELEMETRY_HPP
+#define	_C_TELEMETRY_HPP
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+
+// std
+#include <string>
+
+// boost
+#include <boost/thread/mutex.hpp>
+
+// project
+#include "common_definitions.hpp"
+
+
+/*******************************************************************************
+ * Declarations
+ ******************************************************************************/
+
+
+namespace rfn {
+
+    class Telemetry {
+
+    public:
+        // upper bound of buffered bytes
+        static const unsigned CAPACITY = 65536u;
+        // seconds after which buffered records are written in any case
+        static const double PERIOD;
+
+        struct Record {
+            std::string network;
+            unsigned long time;
+            double flow_error;
+            // negative if not applicable
+            double robustness;
+            double acceptance;
+            double steps_per_second;
+            bool finished;
+        };
+
+    protected:
+        /* Data Members */
+        // file descriptor, negative if the file could not be opened
+        int _output;
+        std::string _buffer;
+        unsigned _interval;
+        double _flushed;
+        boost::mutex _lock;
+
+    public:
+        /* Constructors & Destructor */
+        Telemetry(const std::string& path, const unsigned interval);
+        ~Telemetry();
+
+        /* Member Functions */
+        // number of steps between two records of an evolution
+        unsigned interval() const
+        {
+            return this->_interval;
+        }
+        // append 'record', may be called from any thread
+        void write(const Record& record);
+        // write out all buffered records
+        void flush();
+
+    protected:
+        /* Internal Functions */
+        // write every buffered line by a single 'write', requires '_lock'
+        void drain();
+
+    private:
+        Telemetry(const Telemetry&);
+        Telemetry& operator=(const Telemetry&);
+    };
+
+} // namespace rfn
+
+
+#endif // _C_TELEMETRY_HPP
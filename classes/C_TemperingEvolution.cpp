@@ -0,0 +1,313 @@
+/*******************************************************************************
+ * filename:    C_TemperingEvolution.cpp
+ * description: Implementation of 'TemperingEvolution' class
+ * author:      agent
+ * created:     2026-10-17
+ * copyright:   Jacobs University Bremen. All rights reserved.
+ ******************************************************************************/
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+
+// std
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <algorithm>
+
+// gsl
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_sf_exp.h>
+#include <gsl/gsl_sf_log.h>
+
+// boost
+#include <boost/bind/bind.hpp>
+#include <boost/thread/thread.hpp>
+
+// project
+#include "C_TemperingEvolution.hpp"
+#include "C_Mutation.hpp"
+#include "C_Profile.hpp"
+
+
+/*******************************************************************************
+ * Constructors & Destructor
+ ******************************************************************************/
+
+
+/*
+ * Default constructor
+ */
+rfn::TemperingEvolution::TemperingEvolution():
+    rfn::Evolution(),
+    _replicas(),
+    _steps(),
+    _sweep(0u),
+    _sweeps(0u),
+    _finished(false),
+    _barrier(NULL),
+    _generators(),
+    _resumed()
+{}
+
+/*
+ * Destructor
+ */
+rfn::TemperingEvolution::~TemperingEvolution()
+{
+    delete this->_barrier;
+    this->_barrier = NULL;
+}
+
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+
+
+/*
+ * The main thread only exchanges states between sweeps. A sweep ends early for
+ * a replica that falls below the error threshold and the evolution finishes
+ * with the earliest such replica, otherwise with the best replica at
+ * 'max_time()'.
+ */
+void
+rfn::TemperingEvolution::run(rfn::FlowDistributionNetwork* const f_net)
+{
+    using std::cout;
+    using std::endl;
+    const unsigned num = this->_parameters->temperatures();
+    unsigned when = 0u;
+    bool store = false;
+    if (this->_parameters->snapshots() > 0) {
+        store = true;
+        when = this->_parameters->max_time() /
+            this->_parameters->snapshots();
+    }
+    this->_steps.assign(num, 0u);
+    this->_changes.assign(num, 0u);
+    this->_generators.assign(num, NULL);
+    std::vector<unsigned> seeds(num, 0u);
+    unsigned k = 0u;
+    // replicas evolve independently of the original and its solver, those of
+    // a resumed evolution exist already
+    if (this->_replicas.empty()) {
+        this->_replicas.assign(num, NULL);
+        for (k = 0; k < num; ++k) {
+            this->_replicas[k] = f_net->clone();
+            CHECK_CRITICAL_POINTER(this->_replicas[k]);
+            this->_replicas[k]->isolate();
+            seeds[k] = (unsigned)(this->_parameters->rng()() * 4294967296.0);
+        }
+    }
+    this->_finished = false;
+    this->_barrier = new boost::barrier(num + 1);
+    CHECK_CRITICAL_POINTER(this->_barrier);
+    boost::thread_group workers;
+    for (k = 0; k < num; ++k) {
+        workers.create_thread(rfn::Profile::task(boost::bind(
+            &rfn::TemperingEvolution::advance, this, k, seeds[k])));
+    }
+#ifdef VERBOSE
+    cout << endl;
+#endif
+    this->start_progress();
+    unsigned winner = num;
+    while (this->_current_time <= this->_parameters->max_time()) {
+#ifdef VERBOSE
+        cout << "\033[0F\033[2Ktime: " << this->_current_time <<
+            " flow error: " << this->_replicas[0]->flow_error() << endl;
+#endif
+        this->_sweep = std::min(this->_parameters->swap_interval(),
+            (unsigned)(this->_parameters->max_time() + 1
+            - this->_current_time));
+        if (store && (this->_current_time % when == 0
+            || this->_current_time % when + this->_sweep > when))
+        {
+            // a snapshot falls within this sweep, record the coldest replica
+            this->snapshot(this->_replicas[0], this->_current_time);
+        }
+        // start and end of a sweep
+        this->_barrier->wait();
+        this->_barrier->wait();
+        for (k = 0; k < num; ++k) {
+            this->_attempted += this->_steps[k];
+            this->_accepted += this->_changes[k];
+        }
+        for (k = 0; k < num; ++k) {
+            if (gsl_fcmp(this->_replicas[k]->flow_error(),
+                this->_parameters->error_threshold(), GSL_EPSILON) < 0
+                && (winner == num || this->_steps[k] < this->_steps[winner]))
+            {
+                winner = k;
+            }
+        }
+        if (winner < num) {
+            // flow error is smaller than the required threshold
+            this->_current_time += this->_steps[winner] - 1;
+            break;
+        }
+        this->_current_time += this->_sweep;
+        this->progress(this->_replicas[0], -1.0, false);
+        this->exchange(this->_sweeps % 2);
+        ++this->_sweeps;
+        // the workers wait for the next sweep
+        this->checkpoint(f_net);
+    }
+    this->_finished = true;
+    this->_barrier->wait();
+    workers.join_all();
+    delete this->_barrier;
+    this->_barrier = NULL;
+    if (winner == num) {
+        winner = 0;
+        for (k = 1; k < num; ++k) {
+            if (gsl_fcmp(this->_replicas[k]->flow_error(),
+                this->_replicas[winner]->flow_error(), GSL_EPSILON) < 0)
+            {
+                winner = k;
+            }
+        }
+    }
+    *f_net = *this->_replicas[winner];
+    for (k = 0; k < num; ++k) {
+        delete this->_replicas[k];
+    }
+    this->_replicas.clear();
+    this->_generators.clear();
+    this->_resumed.clear();
+    this->finish(f_net);
+    this->progress(f_net, -1.0, true);
+}
+
+
+/*******************************************************************************
+ * Internal Functions
+ ******************************************************************************/
+
+
+/*
+ * Body of a worker thread, it owns parameters, random number generator and
+ * mutation seeded by 'seed' or restored from a checkpoint. A replica moves
+ * between threads when it is exchanged, thus it is handed the mutation of the
+ * current thread each sweep.
+ */
+void
+rfn::TemperingEvolution::advance(const unsigned k, const unsigned seed)
+{
+    rfn::ParameterManager* const parameters = rfn::ParameterManager::instance(
+        this->_parameters->network_type());
+    parameters->assign(this->_parameters);
+    parameters->seed(seed);
+    if (!this->_resumed.empty()) {
+        std::stringstream state(this->_resumed[k]);
+        state >> parameters->rng();
+    }
+    this->_generators[k] = &parameters->rng();
+    rfn::Mutation* const mutation = rfn::Mutation::instance(
+        parameters->mutation_type());
+    Real dist;
+    Real_Number uniform(parameters->rng(), dist);
+    const double a = this->factor(k);
+    rfn::FlowDistributionNetwork* net = NULL;
+    unsigned s = 0u;
+    unsigned changes = 0u;
+    while (true) {
+        this->_barrier->wait();
+        if (this->_finished) {
+            break;
+        }
+        net = this->_replicas[k];
+        net->mutation(mutation);
+        changes = 0u;
+        for (s = 0; s < this->_sweep;) {
+            if (this->step(net, a, uniform)) {
+                ++changes;
+            }
+            ++s;
+            if (gsl_fcmp(net->flow_error(),
+                this->_parameters->error_threshold(), GSL_EPSILON) < 0)
+            {
+                break;
+            }
+        }
+        this->_steps[k] = s;
+        this->_changes[k] = changes;
+        this->_barrier->wait();
+    }
+    rfn::Mutation::release();
+    rfn::ParameterManager::release();
+}
+
+/*
+ * Replicas at inverse temperatures b_i and b_j exchange their states with
+ * probability min(1, exp((b_i - b_j) (ln e_i - ln e_j))).
+ */
+void
+rfn::TemperingEvolution::exchange(const unsigned first)
+{
+    double delta = 0.0;
+    for (unsigned k = first; k + 1 < this->_replicas.size(); k += 2) {
+        delta = (1.0 / this->factor(k) - 1.0 / this->factor(k + 1))
+            * (gsl_sf_log(std::max(this->_replicas[k]->flow_error(),
+            GSL_DBL_MIN)) - gsl_sf_log(std::max(this->_replicas[k + 1]->
+            flow_error(), GSL_DBL_MIN)));
+        if (delta >= 0.0 || gsl_fcmp((*this->_val_gen)(), gsl_sf_exp(delta),
+            GSL_EPSILON) < 0)
+        {
+            std::swap(this->_replicas[k], this->_replicas[k + 1]);
+        }
+    }
+}
+
+double
+rfn::TemperingEvolution::factor(const unsigned k) const
+{
+    return this->_parameters->annealing_factor()
+        * gsl_pow_int(this->_parameters->temperature_ratio(), (int)k);
+}
+
+/*
+ * A checkpoint is written between sweeps, when the workers neither use the
+ * replicas nor their generators.
+ */
+void
+rfn::TemperingEvolution::write_checkpoint(rfn::BinaryWriter& out,
+    rfn::FlowDistributionNetwork* const f_net)
+{
+    rfn::Evolution::write_checkpoint(out, f_net);
+    out.put_u32(this->_sweeps);
+    out.put_u32((boost::uint32_t)this->_replicas.size());
+    for (unsigned k = 0; k < this->_replicas.size(); ++k) {
+        this->_replicas[k]->write_checkpoint(out, this->_current_time);
+        std::ostringstream state;
+        state << *this->_generators[k];
+        out.put_string(state.str());
+    }
+}
+
+void
+rfn::TemperingEvolution::read_checkpoint(rfn::BinaryReader& in,
+    rfn::FlowDistributionNetwork* const f_net)
+{
+    rfn::Evolution::read_checkpoint(in, f_net);
+    this->_sweeps = in.get_u32();
+    const unsigned num = in.get_u32();
+    if (num != this->_parameters->temperatures()) {
+        std::cerr << "The checkpoint of network '" << f_net->name()
+            << "' has " << num << " replicas. Aborting." << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+    this->_replicas.assign(num, NULL);
+    this->_resumed.assign(num, "");
+    for (unsigned k = 0; k < num; ++k) {
+        this->_replicas[k] = f_net->clone();
+        CHECK_CRITICAL_POINTER(this->_replicas[k]);
+        this->_replicas[k]->isolate();
+        this->_replicas[k]->read_checkpoint(in);
+        this->_resumed[k] = in.get_string();
+    }
+}
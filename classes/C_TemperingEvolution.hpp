@@ -0,0 +1,94 @@
+/*******************************************************************************
+ * filename:    C_TemperingEvolution.hpp
+ * description: Derived class for evolving a flow network by parallel tempering
+ * author:      agent
+ * created:     2026-10-17
+ * copyright:   Jacobs University Bremen. All rights reserved.
+ *******************************************************************************
+ * Replicas of the network are evolved at the annealing factors
+ * a * r^k, k = 0, ..., temperatures() - 1, each in its own thread with its own
+ * random number generator and mutation. Every 'swap_interval()' steps states of
+ * neighbouring replicas are exchanged by a Metropolis criterion so that states
+ * trapped in a local minimum may escape at a higher temperature and good states
+ * found there are refined at a lower one.
+ *
+ * Steps accept with probability exp(-(e' - e) / (a e)) ~ exp(-(ln e' - ln e) / a),
+ * i.e., replicas sample the logarithm of the flow error 'e' at temperature 'a'.
+ * Exchanges are based on the same quantity.
+ ******************************************************************************/
+
+
+#ifndef _C_TEMPERINGEVOLUTION_HPP
+#define	_C_TEMPERINGEVOLUTION_HPP
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+
+// std
+#include <vector>
+#include <string>
+
+// boost
+#include <boost/thread/barrier.hpp>
+
+// project
+#include "C_Evolution.hpp"
+
+
+/*******************************************************************************
+ * Declarations
+ ******************************************************************************/
+
+
+namespace rfn {
+
+    class TemperingEvolution: public Evolution {
+
+        /* Derived From Singleton Pattern */
+        DECLARE_DERIVED_SINGLETON(Evolution, TemperingEvolution)
+
+    protected:
+        /* Data Members */
+        // replicas ordered by increasing temperature
+        std::vector<FlowDistributionNetwork*> _replicas;
+        // steps taken at each temperature in the current sweep
+        std::vector<unsigned> _steps;
+        // accepted steps at each temperature in the current sweep
+        std::vector<unsigned> _changes;
+        unsigned _sweep;
+        // number of completed sweeps
+        unsigned _sweeps;
+        bool _finished;
+        boost::barrier* _barrier;
+        // generators of the worker threads, set before their first sweep
+        std::vector<RandGen*> _generators;
+        // states of the generators of a resumed evolution
+        std::vector<std::string> _resumed;
+
+    public:
+        /* Member Functions */
+        virtual void run(FlowDistributionNetwork* const f_net);
+
+    protected:
+        /* Internal Functions */
+        // evolve the replica at temperature 'k' in each sweep
+        void advance(const unsigned k, const unsigned seed);
+        // attempt exchanges of the pairs (first, first + 1), (first + 2, ...
+        void exchange(const unsigned first);
+        // annealing factor of temperature 'k'
+        double factor(const unsigned k) const;
+        virtual void write_checkpoint(BinaryWriter& out,
+            FlowDistributionNetwork* const f_net);
+        virtual void read_checkpoint(BinaryReader& in,
+            FlowDistributionNetwork* const f_net);
+
+    }; // class TemperingEvolution
+
+} // namespace rfn
+
+
+#endif	// _C_TEMPERINGEVOLUTION_HPP
+
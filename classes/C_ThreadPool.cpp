@@ -0,0 +1,122 @@
+/*******************************************************************************
+ * filename:    C_ThreadPool.cpp
+ * description: Implementation of 'ThreadPool' class
+ * author:      agent
+ * created:     2026-10-17
+ * copyright:   Jacobs University Bremen. All rights reserved.
+ ******************************************************************************/
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+
+// std
+#include <algorithm>
+
+// boost
+#include <boost/bind/bind.hpp>
+
+// project
+#include "C_ThreadPool.hpp"
+
+
+/*******************************************************************************
+ * Constructors & Destructor
+ ******************************************************************************/
+
+
+/*
+ * Default constructor
+ */
+rfn::ThreadPool::ThreadPool(const unsigned count):
+    _count(std::max(1u, count)),
+    _threads(),
+    _lock(),
+    _start(),
+    _done(),
+    _job(NULL),
+    _profile(NULL),
+    _round(0L),
+    _pending(0u),
+    _stopping(false)
+{
+    for (unsigned t = 1; t < this->_count; ++t) {
+        this->_threads.create_thread(boost::bind(&rfn::ThreadPool::work, this,
+            t));
+    }
+}
+
+/*
+ * Destructor
+ */
+rfn::ThreadPool::~ThreadPool()
+{
+    {
+        boost::mutex::scoped_lock guard(this->_lock);
+        this->_stopping = true;
+        this->_start.notify_all();
+    }
+    this->_threads.join_all();
+}
+
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+
+
+void
+rfn::ThreadPool::run(rfn::ThreadPool::Job& job)
+{
+    if (this->_count == 1) {
+        job.share(0u, 1u);
+        return;
+    }
+    {
+        boost::mutex::scoped_lock guard(this->_lock);
+        this->_job = &job;
+        this->_profile = rfn::Profile::current();
+        this->_pending = this->_count - 1;
+        ++this->_round;
+        this->_start.notify_all();
+    }
+    job.share(0u, this->_count);
+    boost::mutex::scoped_lock guard(this->_lock);
+    while (this->_pending > 0) {
+        this->_done.wait(guard);
+    }
+    this->_job = NULL;
+}
+
+
+/*******************************************************************************
+ * Internal Functions
+ ******************************************************************************/
+
+
+void
+rfn::ThreadPool::work(const unsigned index)
+{
+    unsigned long done = 0L;
+    boost::mutex::scoped_lock guard(this->_lock);
+    while (true) {
+        while (!this->_stopping && this->_round == done) {
+            this->_start.wait(guard);
+        }
+        if (this->_stopping) {
+            return;
+        }
+        done = this->_round;
+        rfn::ThreadPool::Job* const job = this->_job;
+        rfn::Profile* const profile = this->_profile;
+        guard.unlock();
+        rfn::Profile::task(profile, boost::bind(&rfn::ThreadPool::Job::share,
+            job, index, this->_count))();
+        guard.lock();
+        if (--this->_pending == 0) {
+            this->_done.notify_one();
+        }
+    }
+}
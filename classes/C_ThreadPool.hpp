@@ -0,0 +1,97 @@
+/*******************************************************************************
+ * filename:    C_ThreadPool.hpp
+ * description: Persistent threads sharing out the work of one thread
+ * author:      agent
+ * created:     2026-10-17
+ * copyright:   Jacobs University Bremen. All rights reserved.
+ *******************************************************************************
+ * A pool of 'count' shares runs 'count - 1' threads for its life time. A job
+ * handed to 'run' is split into 'count' shares, the calling thread takes the
+ * first one and waits for the others, thus running a job costs two hand-overs
+ * rather than starting and joining threads and it allocates no memory. Shares
+ * are profiled as tasks of the thread that runs the job.
+ *
+ * Only one thread at a time may run jobs on a pool.
+ ******************************************************************************/
+
+
+#ifndef _C_THREADPOOL_HPP
+#define	_C_THREADPOOL_HPP
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+
+// boost
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+
+// project
+#include "C_Profile.hpp"
+
+
+/*******************************************************************************
+ * Declarations
+ ******************************************************************************/
+
+
+namespace rfn {
+
+    class ThreadPool {
+
+    public:
+        // work that can be split into shares
+        class Job {
+        public:
+            virtual ~Job() {}
+            // share 'index' of 'count' shares
+            virtual void share(const unsigned index, const unsigned count) = 0;
+        };
+
+    protected:
+        /* Data Members */
+        unsigned _count;
+        boost::thread_group _threads;
+        boost::mutex _lock;
+        boost::condition_variable _start;
+        boost::condition_variable _done;
+        // job of the current round and the profile it counts towards
+        Job* _job;
+        Profile* _profile;
+        unsigned long _round;
+        unsigned _pending;
+        bool _stopping;
+
+    public:
+        /* Constructors & Destructor */
+        ThreadPool(const unsigned count);
+        virtual ~ThreadPool();
+
+        /* Member Functions */
+        // _count get method
+        unsigned count() const
+        {
+            return this->_count;
+        }
+        // run all shares of 'job' and return once they are done
+        void run(Job& job);
+
+    protected:
+        /* Internal Functions */
+        // body of the thread that takes share 'index'
+        void work(const unsigned index);
+
+    private:
+        // not copyable
+        ThreadPool(const ThreadPool&);
+        ThreadPool& operator=(const ThreadPool&);
+
+    }; // class ThreadPool
+
+} // namespace rfn
+
+
+#endif	// _C_THREADPOOL_HPP
@@ -0,0 +1,186 @@
+/*******************************************************************************
+ * filename:    C_Workspace.cpp
+ * description: Implementation of 'Workspace' class
+ * author:      agent
+ * created:     2026-10-17
+ * copyright:   Jacobs University Bremen. All rights reserved.
+ ******************************************************************************/
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+
+// gsl
+#include <gsl/gsl_matrix.h>
+
+// project
+#include "C_Workspace.hpp"
+#include "C_FlowDistributionNetwork.hpp"
+
+
+/*******************************************************************************
+ * Constructors & Destructor
+ ******************************************************************************/
+
+
+/*
+ * Default constructor
+ */
+rfn::Workspace::Workspace(rfn::ParameterManager* const parameters):
+    _parameters(parameters),
+    _components(parameters),
+    _flow(NULL),
+    _permutation(NULL),
+    _candidate(NULL),
+    _population(),
+    _workers(),
+    _pool(NULL),
+    _noise(NULL),
+    _weights(NULL)
+{
+    this->_flow = gsl_matrix_calloc(this->_parameters->nodes_total(),
+        this->_parameters->nodes_in());
+    CHECK_CRITICAL_GSL_POINTER(this->_flow, __FILE__, __LINE__);
+    this->_permutation = gsl_permutation_calloc(
+        this->_parameters->nodes_total());
+    CHECK_CRITICAL_GSL_POINTER(this->_permutation, __FILE__, __LINE__);
+}
+
+/*
+ * Destructor
+ */
+rfn::Workspace::~Workspace()
+{
+    delete this->_pool;
+    this->_pool = NULL;
+    this->fill(this->_workers, NULL, 0u);
+    this->fill(this->_population, NULL, 0u);
+    delete this->_candidate;
+    this->_candidate = NULL;
+    gsl_matrix_free(this->_noise);
+    this->_noise = NULL;
+    gsl_matrix_free(this->_weights);
+    this->_weights = NULL;
+    gsl_matrix_free(this->_flow);
+    this->_flow = NULL;
+    gsl_permutation_free(this->_permutation);
+    this->_permutation = NULL;
+    this->_parameters = NULL; // singleton destroys itself
+}
+
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+
+
+/*
+ * The candidate is cloned once, afterwards it takes over the state of 'f_net'
+ * in place. 'f_net' is expected to own this workspace.
+ */
+rfn::FlowDistributionNetwork*
+rfn::Workspace::candidate(rfn::FlowDistributionNetwork* const f_net)
+{
+    if (this->_candidate == NULL) {
+        this->_candidate = f_net->clone();
+        CHECK_CRITICAL_POINTER(this->_candidate);
+    }
+    else {
+        this->_candidate->copy(*f_net);
+    }
+    return this->_candidate;
+}
+
+
+/*
+ * The copies are isolated anew since they take over the solver of 'f_net'.
+ */
+std::vector<rfn::FlowDistributionNetwork*>&
+rfn::Workspace::population(rfn::FlowDistributionNetwork* const f_net,
+    const unsigned num)
+{
+    this->fill(this->_population, f_net, num);
+    for (unsigned k = 0; k < num; ++k) {
+        this->_population[k]->isolate();
+    }
+    return this->_population;
+}
+
+std::vector<rfn::FlowDistributionNetwork*>&
+rfn::Workspace::workers(rfn::FlowDistributionNetwork* const f_net,
+    const unsigned num)
+{
+    this->fill(this->_workers, f_net, num);
+    return this->_workers;
+}
+
+/*
+ * The pool is only replaced if the number of shares changes, which it does not
+ * during an evolution.
+ */
+rfn::ThreadPool*
+rfn::Workspace::pool(const unsigned count)
+{
+    if (this->_pool != NULL && this->_pool->count() != count) {
+        delete this->_pool;
+        this->_pool = NULL;
+    }
+    if (this->_pool == NULL) {
+        this->_pool = new ThreadPool(count);
+        CHECK_CRITICAL_POINTER(this->_pool);
+    }
+    return this->_pool;
+}
+
+rfn::Matrix*
+rfn::Workspace::noise()
+{
+    if (this->_noise == NULL) {
+        this->_noise = gsl_matrix_calloc(this->_parameters->nodes_total(),
+            this->_parameters->nodes_total());
+        CHECK_CRITICAL_GSL_POINTER(this->_noise, __FILE__, __LINE__);
+    }
+    return this->_noise;
+}
+
+rfn::Matrix*
+rfn::Workspace::weights()
+{
+    if (this->_weights == NULL) {
+        this->_weights = gsl_matrix_calloc(this->_parameters->nodes_total(),
+            this->_parameters->nodes_total());
+        CHECK_CRITICAL_GSL_POINTER(this->_weights, __FILE__, __LINE__);
+    }
+    return this->_weights;
+}
+
+
+/*******************************************************************************
+ * Internal Functions
+ ******************************************************************************/
+
+
+/*
+ * Copies missing from 'num' are cloned, surplus ones deleted and the others
+ * take over the state of 'f_net' in place.
+ */
+void
+rfn::Workspace::fill(std::vector<rfn::FlowDistributionNetwork*>& copies,
+    rfn::FlowDistributionNetwork* const f_net, const unsigned num)
+{
+    while (copies.size() > num) {
+        delete copies.back();
+        copies.pop_back();
+    }
+    for (unsigned k = 0; k < num; ++k) {
+        if (k < copies.size()) {
+            copies[k]->copy(*f_net);
+        }
+        else {
+            copies.push_back(f_net->clone());
+            CHECK_CRITICAL_POINTER(copies.back());
+        }
+    }
+}
@@ -0,0 +1,125 @@
+/*******************************************************************************
+ * filename:    C_Workspace.hpp
+ * description: Buffers for the evaluation and mutation of a flow network
+ * author:      agent
+ * created:     2026-10-17
+ * copyright:   Jacobs University Bremen. All rights reserved.
+ *******************************************************************************
+ * A network creates its workspace when it is first evaluated and keeps it for
+ * its lifetime. Together with the mutated copies that are recycled from one
+ * evolutionary step to the next this means that the steps of an evolution do
+ * not allocate any memory once the first few have been taken.
+ *
+ * A workspace is not shared between networks and thus follows its network from
+ * thread to thread. The copies and the pool that share out the noise
+ * realisations of a robustness computation are kept as well, each copy holds
+ * the noise buffers in a workspace of its own.
+ ******************************************************************************/
+
+
+#ifndef _C_WORKSPACE_HPP
+#define	_C_WORKSPACE_HPP
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+
+// std
+#include <vector>
+
+// gsl
+#include <gsl/gsl_permutation.h>
+
+// project
+#include "common_definitions.hpp"
+#include "C_ParameterManager.hpp"
+#include "C_ComponentSolver.hpp"
+#include "C_ThreadPool.hpp"
+
+
+/*******************************************************************************
+ * Declarations
+ ******************************************************************************/
+
+
+namespace rfn {
+
+    class FlowDistributionNetwork;
+
+    class Workspace {
+
+    protected:
+        /* Data Members */
+        ParameterManager* _parameters;
+        ComponentSolver _components;
+        // flow through each node (rows) for each input node (columns)
+        Matrix* _flow;
+        // pivots of a dense LU decomposition of the SLE
+        gsl_permutation* _permutation;
+        // mutated copy of the owning network
+        FlowDistributionNetwork* _candidate;
+        // mutated copies of the owning network evaluated side by side
+        std::vector<FlowDistributionNetwork*> _population;
+        // copies of the owning network evaluating its noise realisations
+        std::vector<FlowDistributionNetwork*> _workers;
+        // NULL until realisations are shared out
+        ThreadPool* _pool;
+        // noisy SLE and link weights of one realisation, NULL until needed
+        Matrix* _noise;
+        Matrix* _weights;
+
+    public:
+        /* Constructors & Destructor */
+        Workspace(ParameterManager* const parameters);
+        virtual ~Workspace();
+
+        /* Member Functions */
+        // _components get method
+        ComponentSolver& components()
+        {
+            return this->_components;
+        }
+        // _flow get method
+        Matrix* flow()
+        {
+            return this->_flow;
+        }
+        // _permutation get method
+        gsl_permutation* permutation()
+        {
+            return this->_permutation;
+        }
+        // copy of 'f_net' held in the memory of the previous candidate
+        FlowDistributionNetwork* candidate(FlowDistributionNetwork* const f_net);
+        // 'num' copies of 'f_net' detached from its solver, held in the
+        // memory of the previous ones
+        std::vector<FlowDistributionNetwork*>& population(
+            FlowDistributionNetwork* const f_net, const unsigned num);
+        // 'num' copies of 'f_net' held in the memory of the previous ones
+        std::vector<FlowDistributionNetwork*>& workers(
+            FlowDistributionNetwork* const f_net, const unsigned num);
+        // pool of 'count' shares, created on first use
+        ThreadPool* pool(const unsigned count);
+        // square matrices of 'nodes_total()', created on first use
+        Matrix* noise();
+        Matrix* weights();
+
+    protected:
+        /* Internal Functions */
+        // turn 'copies' into 'num' copies of 'f_net'
+        static void fill(std::vector<FlowDistributionNetwork*>& copies,
+            FlowDistributionNetwork* const f_net, const unsigned num);
+
+    private:
+        // not copyable
+        Workspace(const Workspace&);
+        Workspace& operator=(const Workspace&);
+
+    }; // class Workspace
+
+} // namespace rfn
+
+
+#endif	// _C_WORKSPACE_HPP
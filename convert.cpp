@@ -0,0 +1,314 @@
+/*******************************************************************************
+ * filename:    convert.cpp
+ * description: Converts legacy result files to the portable format
+ * author:      agent
+ * created:     2026-10-17
+ * copyright:   Jacobs University Bremen. All rights reserved.
+ *******************************************************************************
+ * Every 'parameters.dat' and every other '.dat' file next to it below the given
+ * directories that is in the legacy format is rewritten in the portable
+ * format described in 'C_BinaryStream.hpp'. Files already in the portable
+ * format are left alone. Legacy files are read with the width of
+ * 'unsigned long' and the byte order of the machine that wrote them, given by
+ * '--long-size' and '--swapped'.
+ *
+ * Legacy parameter files do not contain the maximum time, it is stored as
+ * zero. A file is converted into a temporary copy that replaces the original
+ * only once it is complete, files that do not match the layer sizes of their
+ * directory are reported and left alone.
+ ******************************************************************************/
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+
+// std
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include <string>
+#include <algorithm>
+
+// boost
+#include <boost/filesystem/fstream.hpp>
+
+// project
+#include "rfn_config.hpp"
+#include "common_definitions.hpp"
+#include "C_BinaryStream.hpp"
+#include "C_ResultView.hpp"
+
+
+/*******************************************************************************
+ * Declarations
+ ******************************************************************************/
+
+
+// options of the conversion
+struct Settings {
+    std::vector<std::string> directories;
+    unsigned long_size;
+    bool swapped;
+};
+
+// result of converting one file
+enum Outcome {
+    converted,
+    portable,
+    failed
+};
+
+
+/*******************************************************************************
+ * Function Declarations
+ ******************************************************************************/
+
+
+Settings parse_arguments(int argc, char** argv);
+bool read_layers(const bfsys::path& file, const Settings& settings,
+    rfn::ResultView::Layers& layers);
+Outcome convert_parameters(const bfsys::path& file, const Settings& settings);
+Outcome convert_state(const bfsys::path& file,
+    const rfn::ResultView::Layers& layers, const Settings& settings);
+// replace 'file' by 'tmp' if 'success', else remove 'tmp'
+Outcome replace(const bfsys::path& file, const bfsys::path& tmp,
+    const bool success);
+
+
+/*******************************************************************************
+ * Function Definitions
+ ******************************************************************************/
+
+
+int main(int argc, char** argv) {
+    using std::cerr;
+    using std::endl;
+    const Settings settings = parse_arguments(argc, argv);
+    std::vector<bfsys::path> dirs;
+    for (unsigned d = 0; d < settings.directories.size(); ++d) {
+        const bfsys::path dir(settings.directories[d]);
+        if (!bfsys::is_directory(dir)) {
+            cerr << "'" << dir.string() << "' is not a directory, skipped."
+                << endl;
+            continue;
+        }
+        dirs.push_back(dir);
+        for (bfsys::recursive_directory_iterator it(dir), end; it != end;
+            ++it)
+        {
+            if (bfsys::is_directory(it->status())) {
+                dirs.push_back(it->path());
+            }
+        }
+    }
+    unsigned counts[3] = {0u, 0u, 0u};
+    for (unsigned d = 0; d < dirs.size(); ++d) {
+        const bfsys::path parameters = dirs[d] / "parameters.dat";
+        rfn::ResultView::Layers layers;
+        if (!bfsys::exists(parameters) || !read_layers(parameters, settings,
+            layers))
+        {
+            continue;
+        }
+        std::vector<bfsys::path> files;
+        for (bfsys::directory_iterator it(dirs[d]), end; it != end; ++it) {
+            if (bfsys::is_regular_file(it->status())
+                && it->path().extension() == ".dat"
+                && it->path().filename() != "parameters.dat")
+            {
+                files.push_back(it->path());
+            }
+        }
+        std::sort(files.begin(), files.end());
+        for (unsigned k = 0; k < files.size(); ++k) {
+            ++counts[convert_state(files[k], layers, settings)];
+        }
+        ++counts[convert_parameters(parameters, settings)];
+    }
+    std::cout << counts[converted] << " converted, " << counts[portable]
+        << " already portable, " << counts[failed] << " failed" << endl;
+    return (counts[failed] == 0u) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+Settings
+parse_arguments(int argc, char** argv)
+{
+    using std::cout;
+    using std::cerr;
+    using std::endl;
+    bpo::options_description options("Options");
+    options.add_options()
+        ("help,h", "print help message")
+        ("version,v", "print version information")
+        ("long-size", bpo::value<unsigned>()->default_value(
+            sizeof(unsigned long)),
+            "bytes of 'unsigned long' on the machine that wrote the files"
+            " (4 | 8)")
+        ("swapped", "the files were written by a machine with the other byte"
+            " order")
+        ("directory", bpo::value<std::vector<std::string> >(),
+            "directories searched recursively for legacy files")
+    ;
+    bpo::positional_options_description positional;
+    positional.add("directory", -1);
+    bpo::variables_map vm;
+    try {
+        bpo::store(bpo::command_line_parser(argc, argv).options(options).
+            positional(positional).run(), vm);
+        bpo::notify(vm);
+    }
+    catch (std::exception& e) {
+        cerr << e.what() << endl;
+        std::exit(EXIT_FAILURE);
+    }
+    if (vm.count("help")) {
+        cout << "Usage:" << endl;
+        cout << argv[0] << " [options] directory [directory ...]" << endl;
+        cout << options << endl;
+        std::exit(EXIT_SUCCESS);
+    }
+    if (vm.count("version")) {
+        cout << RFN5_VERSION_MAJOR << "." << RFN5_VERSION_MINOR << "."
+            << RFN5_VERSION_PATCH << endl;
+        std::exit(EXIT_SUCCESS);
+    }
+    Settings settings;
+    if (vm.count("directory")) {
+        settings.directories = vm["directory"].as<std::vector<std::string> >();
+    }
+    else {
+        settings.directories.push_back(".");
+    }
+    settings.long_size = vm["long-size"].as<unsigned>();
+    if (settings.long_size != 4u && settings.long_size != 8u) {
+        cerr << "The size of 'unsigned long' has to be 4 or 8. Aborting."
+            << endl;
+        std::exit(EXIT_FAILURE);
+    }
+    settings.swapped = vm.count("swapped") > 0;
+    return settings;
+}
+
+bool
+read_layers(const bfsys::path& file, const Settings& settings,
+    rfn::ResultView::Layers& layers)
+{
+    bfsys::ifstream in(file, std::ios::binary);
+    rfn::BinaryReader reader(in, rfn::BinaryFormat::PARAMETERS_MAGIC,
+        settings.long_size, settings.swapped);
+    reader.get_u16();
+    layers.nodes_in = reader.get_u16();
+    layers.nodes_middle = reader.get_u16();
+    layers.nodes_out = reader.get_u16();
+    return in && layers.nodes_in > 0u && layers.nodes_out > 0u;
+}
+
+/*
+ * The values follow 'ParameterManager::write_to_binary_stream', those of
+ * derived classes are doubles.
+ */
+Outcome
+convert_parameters(const bfsys::path& file, const Settings& settings)
+{
+    bfsys::ifstream in(file, std::ios::binary);
+    rfn::BinaryReader reader(in, rfn::BinaryFormat::PARAMETERS_MAGIC,
+        settings.long_size, settings.swapped);
+    if (!reader.legacy()) {
+        return portable;
+    }
+    const bfsys::path tmp = file.string() + ".tmp";
+    bfsys::ofstream out(tmp, std::ios::binary);
+    rfn::BinaryWriter writer(out, rfn::BinaryFormat::PARAMETERS_MAGIC);
+    unsigned k = 0;
+    // version and layer sizes
+    for (k = 0; k < 5; ++k) {
+        writer.put_u16(reader.get_u16());
+    }
+    writer.put_f64(reader.get_f64());
+    writer.put_f64(reader.get_f64());
+    // in place of the maximum time
+    reader.get_u64();
+    writer.put_u64(0u);
+    writer.put_u16(reader.get_u16());
+    writer.put_f64(reader.get_f64());
+    writer.put_f64(reader.get_f64());
+    // schemes
+    for (k = 0; k < 4; ++k) {
+        writer.put_u16(reader.get_u16());
+    }
+    while (!reader.at_end()) {
+        writer.put_f64(reader.get_f64());
+    }
+    writer.finish();
+    out.close();
+    const bool success = reader.finish() && out;
+    in.close();
+    return replace(file, tmp, success);
+}
+
+/*
+ * The values follow 'FlowDistributionNetwork::write_to_binary_stream' with an
+ * optional robustness at the end.
+ */
+Outcome
+convert_state(const bfsys::path& file, const rfn::ResultView::Layers& layers,
+    const Settings& settings)
+{
+    bfsys::ifstream in(file, std::ios::binary);
+    rfn::BinaryReader reader(in, rfn::BinaryFormat::STATE_MAGIC,
+        settings.long_size, settings.swapped);
+    if (!reader.legacy()) {
+        return portable;
+    }
+    const bfsys::path tmp = file.string() + ".tmp";
+    bfsys::ofstream out(tmp, std::ios::binary);
+    rfn::BinaryWriter writer(out, rfn::BinaryFormat::STATE_MAGIC);
+    writer.put_u32(layers.nodes_in);
+    writer.put_u32(layers.nodes_middle);
+    writer.put_u32(layers.nodes_out);
+    writer.put_u64(reader.get_u64());
+    writer.put_u32(reader.get_u32());
+    writer.put_f64(reader.get_f64());
+    writer.put_f64(reader.get_f64());
+    const unsigned num_edges = reader.get_u32();
+    writer.put_u32(num_edges);
+    const unsigned num_nodes = layers.nodes_in + layers.nodes_middle +
+        layers.nodes_out;
+    bool success = true;
+    boost::uint32_t node = 0u;
+    for (unsigned k = 0; k < 2 * num_edges && success; ++k) {
+        node = reader.get_u32();
+        success = node < num_nodes && !reader.at_end();
+        writer.put_u32(node);
+    }
+    const unsigned cells = layers.nodes_in * layers.nodes_out;
+    for (unsigned k = 0; k < cells && success; ++k) {
+        writer.put_f64(reader.get_f64());
+    }
+    // robustness
+    if (success && !reader.at_end()) {
+        writer.put_f64(reader.get_f64());
+    }
+    writer.finish();
+    out.close();
+    success = success && reader.at_end() && reader.finish() && out;
+    in.close();
+    if (!success) {
+        std::cerr << "'" << file.string() << "' does not match the layer sizes"
+            " of its directory, skipped." << std::endl;
+    }
+    return replace(file, tmp, success);
+}
+
+Outcome
+replace(const bfsys::path& file, const bfsys::path& tmp, const bool success)
+{
+    if (!success) {
+        bfsys::remove(tmp);
+        return failed;
+    }
+    bfsys::rename(tmp, file);
+    return converted;
+}
@@ -12,6 +12,10 @@
  * The instance is dynamically allocated on the heap and will only be destroyed
  * once the program exits.
  *
+ * Instances are local to the thread that creates them such that concurrent
+ * simulations each own a full set of singletons. Threads other than the main
+ * thread must destroy their instances by calling 'release'.
+ *
  * The 'instance' member function of the base class should be overloaded so that
  * child classes are dynamically created through it. It can do so because it is
  * declared a 'friend' in all derived classes.
@@ -28,6 +32,12 @@
 #define	_M_SINGLETON_HPP
 
 
+/*
+ * Storage class of the instance pointers, a GNU extension.
+ */
+#define SINGLETON_THREAD_LOCAL __thread
+
+
 /*
  * Necessary declarations for creating a base class implementing the singleton
  * pattern.
@@ -38,7 +48,7 @@
         virtual ~CLASS();                                                      \
                                                                                \
     private:                                                                   \
-        static CLASS* _instance;                                               \
+        static SINGLETON_THREAD_LOCAL CLASS* _instance;                        \
         CLASS(const CLASS&);                                                   \
         CLASS& operator=(const CLASS&);                                        \
         CLASS& operator=(CLASS&);                                              \
@@ -50,7 +60,8 @@
         friend class Guard;                                                    \
                                                                                \
     public:                                                                    \
-        static CLASS* instance();
+        static CLASS* instance();                                              \
+        static void release();
 
 
 /*
@@ -60,9 +71,15 @@
  * full specifier or employ the appropriate 'using' directives.
  */
 #define DEFINE_BASE_SINGLETON(CLASS)                                           \
-    CLASS* CLASS::_instance = NULL;                                            \
+    SINGLETON_THREAD_LOCAL CLASS* CLASS::_instance = NULL;                     \
                                                                                \
     CLASS::Guard::~Guard()                                                     \
+    {                                                                          \
+        CLASS::release();                                                      \
+    }                                                                          \
+                                                                               \
+    void                                                                       \
+    CLASS::release()                                                           \
     {                                                                          \
         if (CLASS::_instance) {                                                \
             delete CLASS::_instance;                                           \
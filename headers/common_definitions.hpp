@@ -29,9 +29,6 @@
 #include <boost/accumulators/statistics/mean.hpp>
 #include <boost/accumulators/statistics/variance.hpp>
 #include <boost/filesystem.hpp>
-#include <boost/graph/adjacency_list.hpp>
-#include <boost/graph/adjacency_matrix.hpp>
-#include <boost/graph/property_maps/container_property_map.hpp>
 #include <boost/random/lagged_fibonacci.hpp>
 #include <boost/program_options.hpp>
 
@@ -39,6 +36,9 @@
 #include <gsl/gsl_matrix.h>
 #include <gsl/gsl_errno.h>
 
+// project
+#include "C_BitAdjacency.hpp"
+
 
 /*******************************************************************************
  * Namespace Aliases
@@ -61,10 +61,8 @@ namespace rfn {
 //    typedef boost::adjacency_list<boost::setS, boost::vecS, boost::bidirectionalS,
 //        boost::no_property, boost::no_property, boost::no_property, boost::listS>
 //        adj_list;
-    typedef boost::adjacency_matrix<boost::directedS> Adjacency;
-    typedef boost::graph_traits<Adjacency>::vertex_descriptor Vertex;
-    typedef boost::container_property_map<Adjacency, Vertex,
-        std::vector<boost::default_color_type> > ColourMap;
+//    typedef boost::adjacency_matrix<boost::directedS> Adjacency;
+    typedef BitAdjacency Adjacency;
     typedef boost::lagged_fibonacci607 RandGen;
     typedef bacc::accumulator_set<double, bacc::stats<bacc::tag::mean,
         bacc::tag::variance> > Statistics;
@@ -112,6 +110,21 @@ namespace rfn {
         list
     };
 
+    enum SolverScheme {
+        dense_lu,
+        sparse_lu
+    };
+
+    enum BackendScheme {
+        gsl_backend,
+        dense_backend
+    };
+
+    enum SelectionScheme {
+        best_candidate,
+        first_accepted
+    };
+
 } // namespace rfn
 
 
@@ -38,9 +38,7 @@
 #include "C_ParameterManager.hpp"
 #include "C_RobustParameterManager.hpp"
 #include "C_NoiseRobustParameterManager.hpp"
-#include "C_NetworkBuilder.hpp"
-#include "C_FlowDistributionNetwork.hpp"
-#include "C_Evolution.hpp"
+#include "C_ReplicaRunner.hpp"
 
 
 /*******************************************************************************
@@ -50,7 +48,8 @@
 
 std::vector<std::string>* parse_arguments(int argc, char** argv);
 void verify_parameters(rfn::ParameterManager* const parameters);
-bool verify_name(std::string dup_name, bfsys::path dir);
+bool verify_name(std::string dup_name, bfsys::path dir,
+    const std::vector<bfsys::path>& claimed, const bool resume);
 
 
 /*******************************************************************************
@@ -65,27 +64,24 @@ int main(int argc, char** argv) {
     // turn off GSL error handler
 //    gsl_error_handler_t* const old_handler = gsl_set_error_handler_off();
     gsl_set_error_handler_off();
-    // network builder, singleton
-    rfn::NetworkBuilder* builder = rfn::NetworkBuilder::instance();
     // vector of networks to simulate from parameters
     std::vector<std::string>* const names =
         parse_arguments(argc, argv);
-    // get parameter singleton instance
+    // get parameter singleton instance, template for all networks
     rfn::ParameterManager* const parameters = rfn::ParameterManager::instance();
-    // define evolution type from parameters
-    rfn::Evolution* const evolution =
-        rfn::Evolution::instance(parameters->network_type());
     // choose a seed if not given
     if (parameters->seed() == 0) {
         parameters->seed(std::time(NULL) + getpid());
     }
-    rfn::RandGen rng_state(parameters->rng());
-    bool conn_not_given = true;
-    if (parameters->connectivity() != 0.0) {
-        conn_not_given = false;
-    }
-    // for each network perform evolution
-    rfn::FlowDistributionNetwork* network = NULL;
+    const unsigned seed = parameters->seed();
+    const double connectivity = parameters->connectivity();
+    // evolves the networks concurrently
+    rfn::ReplicaRunner runner(parameters);
+    // parameters of each network, the n-th network uses seed + n
+    std::vector<unsigned> seeds;
+    std::vector<double> connectivities;
+    // names are fixed before any network is evolved
+    std::vector<bfsys::path> claimed;
     std::string dup_name;
     bfsys::path dir;
     bfsys::path tmp;
@@ -94,18 +90,22 @@ int main(int argc, char** argv) {
     for (std::vector<std::string>::iterator name_it =
         names->begin(); name_it != names->end(); ++name_it)
     {
-        parameters->rng() = rng_state;
+        seeds.push_back(seed + (unsigned)seeds.size());
         // choose connectivity if not given
-        if (conn_not_given) {
-            std::srand(parameters->seed());
-            parameters->connectivity((double)std::rand() / (double)RAND_MAX);
+        if (connectivity == 0.0) {
+            std::srand(seeds.back());
+            connectivities.push_back((double)std::rand() / (double)RAND_MAX);
+        }
+        else {
+            connectivities.push_back(connectivity);
         }
         dir = *name_it;
         // verify network name
         if (bfsys::exists(dir.parent_path())) {
             dup_name = dir.filename().string();
             try {
-                name_exists = verify_name(dup_name, dir.parent_path());
+                name_exists = verify_name(dup_name, dir.parent_path(),
+                    claimed, parameters->resume());
             }
             catch (bfsys::filesystem_error& e) {
                 name_exists = false;
@@ -114,7 +114,8 @@ int main(int argc, char** argv) {
             while (name_exists) {
                 dup_name.append("_duplicate");
                 try {
-                    name_exists = verify_name(dup_name, dir.parent_path());
+                    name_exists = verify_name(dup_name, dir.parent_path(),
+                        claimed, parameters->resume());
                 }
                 catch (bfsys::filesystem_error& e) {
                     name_exists = false;
@@ -125,7 +126,8 @@ int main(int argc, char** argv) {
             dup_name = dir.filename().string();
             dir = ".";
             try {
-                name_exists = verify_name(dup_name, dir);
+                name_exists = verify_name(dup_name, dir, claimed,
+                    parameters->resume());
             }
             catch (bfsys::filesystem_error& e) {
                 name_exists = false;
@@ -134,7 +136,8 @@ int main(int argc, char** argv) {
             while (name_exists) {
                 dup_name.append("_duplicate");
                 try {
-                    name_exists = verify_name(dup_name, dir);
+                    name_exists = verify_name(dup_name, dir, claimed,
+                    parameters->resume());
                 }
                 catch (bfsys::filesystem_error& e) {
                     name_exists = false;
@@ -143,24 +146,31 @@ int main(int argc, char** argv) {
         }
         else {
             cerr << "Directory does not exist, skipping." << endl;
+            seeds.pop_back();
+            connectivities.pop_back();
             continue;
         }
-        network = builder->build(parameters, bfsys::path(dir.parent_path() /
-            dup_name).string());
-        // evolution
-        evolution->run(network);
-        delete network;
-        network = NULL;
-        // store parameters
-        tmp = dir.parent_path() / "parameters.dat";
+        claimed.push_back(dir.parent_path() / dup_name);
+        runner.add(claimed.back().string(), seeds.back(),
+            connectivities.back());
+    }
+    // evolution
+    runner.run();
+    // store parameters of the first network in each directory
+    for (unsigned n = 0; n < claimed.size(); ++n) {
+        tmp = claimed[n].parent_path() / "parameters.dat";
         if (!bfsys::exists(tmp)) {
+            parameters->seed(seeds[n]);
+            parameters->connectivity(connectivities[n]);
             output.open(tmp, std::ios::binary);
-            parameters->write_to_binary_stream(output);
+            rfn::BinaryWriter writer(output,
+                rfn::BinaryWriter::PARAMETERS_MAGIC);
+            parameters->write_to_binary_stream(writer);
+            writer.finish();
             output.close();
         }
     }
     // clean-up
-    builder = NULL; // singleton destroys itself
     names->clear();
     delete names;
     return (EXIT_SUCCESS);
@@ -227,6 +237,52 @@ parse_arguments(int argc, char** argv)
             "equal-spread)")
         ("mutation", bpo::value<std::string>()->default_value("path"),
             "how to mutate the network ('path' | 'link')")
+        ("solver", bpo::value<std::string>()->default_value("dense"),
+            "how to solve the flow equations ('dense' | 'sparse')")
+        ("backend", bpo::value<std::string>()->default_value("gsl"),
+            "linear algebra backend ('gsl' | 'dense'), 'dense' is faster but"
+            " rounds differently")
+        ("incremental", "re-evaluate mutated networks by low-rank updates of the"
+            " current network's solution")
+        ("early-exit", "stop evaluating a mutated network in between the input"
+            " nodes once its flow error exceeds the acceptance bound")
+        ("profile", "write the time spent per phase and the step counts of"
+            " every network to '<name>_profile.txt'")
+        ("telemetry", bpo::value<std::string>(),
+            "append progress records of every network as JSON lines to a file,"
+            " e.g., /dev/stdout or /dev/fd/3 (path)")
+        ("telemetry-interval", bpo::value<unsigned>()->default_value(1000),
+            "number of steps between two progress records (integer)")
+        ("archive", bpo::value<std::string>(),
+            "append snapshots and final states of all networks to a single"
+            " archive file instead of one file each (path)")
+        ("checkpoint", bpo::value<unsigned>()->default_value(0),
+            "number of steps between two checkpoints of every network in"
+            " '<name>.checkpoint', 0 disables checkpoints (integer)")
+        ("resume", "continue every network from its checkpoint, networks"
+            " whose final state has been written are skipped")
+        ("threads", bpo::value<unsigned>()->default_value(1),
+            "number of threads for independent evaluations per network, with"
+            " several candidates they are divided between the candidates and"
+            " their noise realisations (integer)")
+        ("jobs", bpo::value<unsigned>()->default_value(1),
+            "number of networks evolved concurrently (integer)")
+        ("temperatures", bpo::value<unsigned>()->default_value(1),
+            "number of replicas of a flow network evolved in parallel at"
+            " increasing annealing factors that exchange their states, 1"
+            " disables parallel tempering, which excludes several candidates"
+            " (integer)")
+        ("temperature-ratio", bpo::value<double>()->default_value(2.0),
+            "ratio of the annealing factors of neighbouring replicas (decimal"
+            " greater than 1)")
+        ("swap-interval", bpo::value<unsigned>()->default_value(100),
+            "number of steps between exchanges of replica states (integer)")
+        ("candidates", bpo::value<unsigned>()->default_value(1),
+            "number of mutated networks evaluated in parallel per step"
+            " (integer)")
+        ("selection", bpo::value<std::string>()->default_value("best"),
+            "which of several mutated networks is considered for acceptance"
+            " ('best' | 'first' accepted in order of generation)")
         ("connectivity,c", bpo::value<double>(),
             "connectivity of the initial network (decimal between 0 and 1)")
         ("add-to", bpo::value<double>()->default_value(0.5),
@@ -237,6 +293,10 @@ parse_arguments(int argc, char** argv)
         ("robust-factor", bpo::value<double>()->default_value(0.0001),
             "factor in acceptance of mutation due to annealing in robustness"
             " (decimal)")
+        ("confidence", bpo::value<double>()->default_value(0.0),
+            "confidence at which sampling of noise realisations stops once a"
+            " mutation is settled to be rejected, 0 samples all (0 or decimal"
+            " between 0.5 and 1)")
         ("min-robustness", bpo::value<double>()->default_value(1.0),
             "minimum robustness the network should evolve to (decimal between"
             " 0 and 1)")
@@ -357,6 +417,57 @@ parse_arguments(int argc, char** argv)
         cerr << "No known mutation scheme specified. Aborting." << endl;
         std::exit(EXIT_FAILURE);
     }
+    // linear solver type
+    if (vm["solver"].as<std::string>() == "dense") {
+        parameters->solver_type(rfn::dense_lu);
+    }
+    else if (vm["solver"].as<std::string>() == "sparse") {
+        parameters->solver_type(rfn::sparse_lu);
+    }
+    else {
+        cerr << "No known linear solver specified. Aborting." << endl;
+        std::exit(EXIT_FAILURE);
+    }
+    // linear algebra backend
+    if (vm["backend"].as<std::string>() == "dense") {
+        parameters->backend(rfn::dense_backend);
+    }
+    else if (vm["backend"].as<std::string>() == "gsl") {
+        parameters->backend(rfn::gsl_backend);
+    }
+    else {
+        cerr << "No known linear algebra backend specified. Aborting." << endl;
+        std::exit(EXIT_FAILURE);
+    }
+    // selection among several candidates
+    if (vm["selection"].as<std::string>() == "best") {
+        parameters->selection(rfn::best_candidate);
+    }
+    else if (vm["selection"].as<std::string>() == "first") {
+        parameters->selection(rfn::first_accepted);
+    }
+    else {
+        cerr << "No known selection scheme specified. Aborting." << endl;
+        std::exit(EXIT_FAILURE);
+    }
+    parameters->incremental(vm.count("incremental") > 0);
+    parameters->early_exit(vm.count("early-exit") > 0);
+    parameters->profile(vm.count("profile") > 0);
+    if (vm.count("telemetry")) {
+        parameters->telemetry(vm["telemetry"].as<std::string>());
+    }
+    parameters->telemetry_interval(vm["telemetry-interval"].as<unsigned>());
+    if (vm.count("archive")) {
+        parameters->archive(vm["archive"].as<std::string>());
+    }
+    parameters->checkpoint_interval(vm["checkpoint"].as<unsigned>());
+    parameters->resume(vm.count("resume") > 0);
+    parameters->threads(vm["threads"].as<unsigned>());
+    parameters->jobs(vm["jobs"].as<unsigned>());
+    parameters->temperatures(vm["temperatures"].as<unsigned>());
+    parameters->temperature_ratio(vm["temperature-ratio"].as<double>());
+    parameters->swap_interval(vm["swap-interval"].as<unsigned>());
+    parameters->candidates(vm["candidates"].as<unsigned>());
     // set other parameters
     parameters->nodes_in(vm["input-nodes"].as<short unsigned>());
     parameters->nodes_middle(vm["middle-nodes"].as<short unsigned>());
@@ -400,6 +511,7 @@ parse_arguments(int argc, char** argv)
         robust_parameters->min_robustness(vm["min-robustness"].as<double>());
         robust_parameters->robust_threshold(vm["robust-threshold"].as<double>());
         robust_parameters->robust_factor(vm["robust-factor"].as<double>());
+        robust_parameters->confidence(vm["confidence"].as<double>());
         robust_parameters->noise_level(vm["noise-robust"].as<double>());
     }
     // test sensibility of parameters provided
@@ -419,6 +531,33 @@ verify_parameters(rfn::ParameterManager* const parameters)
     assert(parameters->nodes_in() > 0);
     assert(parameters->nodes_middle() > 0);
     assert(parameters->nodes_out() > 0);
+    // options of the parallel evolution, a zero would stall it
+    if (parameters->threads() == 0 || parameters->jobs() == 0
+        || parameters->candidates() == 0)
+    {
+        cerr << "The numbers of threads, jobs and candidates must be positive."
+            " Aborting." << endl;
+        std::exit(EXIT_FAILURE);
+    }
+    if (parameters->temperatures() == 0 || parameters->swap_interval() == 0) {
+        cerr << "The numbers of temperatures and steps between swaps must be"
+            " positive. Aborting." << endl;
+        std::exit(EXIT_FAILURE);
+    }
+    if (!(parameters->temperature_ratio() > 1.0)) {
+        cerr << "The temperature ratio must be greater than 1. Aborting."
+            << endl;
+        std::exit(EXIT_FAILURE);
+    }
+    // replicas make one single candidate step at a time
+    if (parameters->temperatures() > 1
+        && (parameters->network_type() != rfn::flow_evolved
+        || parameters->candidates() > 1))
+    {
+        cerr << "Parallel tempering evolves flow networks with a single"
+            " candidate only. Aborting." << endl;
+        std::exit(EXIT_FAILURE);
+    }
     if (parameters->nodes_in() >= parameters->nodes_middle()
         || parameters->nodes_out() >= parameters->nodes_middle())
     {
@@ -442,6 +581,15 @@ verify_parameters(rfn::ParameterManager* const parameters)
     if (typeid(*parameters) == typeid(rfn::NoiseRobustParameterManager)) {
         rfn::NoiseRobustParameterManager* robust_parameters = static_cast
             <rfn::NoiseRobustParameterManager*>(parameters);
+        // the Wilson score bound needs a positive quantile
+        if (robust_parameters->confidence() != 0.0
+            && !(robust_parameters->confidence() > 0.5
+            && robust_parameters->confidence() < 1.0))
+        {
+            cerr << "The confidence must be 0 or lie between 0.5 and 1."
+                " Aborting." << endl;
+            std::exit(EXIT_FAILURE);
+        }
         if (robust_parameters->noise_level() == 0.0) {
             cerr << "Warning: Noise robust networks with zero noise intensity"
                 " reduce to node robust networks." << endl;
@@ -453,9 +601,30 @@ verify_parameters(rfn::ParameterManager* const parameters)
     }
 }
 
+/*
+ * Networks that are resumed keep their names, thus the files of the directory
+ * do not count then.
+ */
 bool
-verify_name(std::string dup_name, bfsys::path dir)
+verify_name(std::string dup_name, bfsys::path dir,
+    const std::vector<bfsys::path>& claimed, const bool resume)
 {
+    // names taken by networks that are yet to be evolved
+    bfsys::path parent;
+    for (unsigned n = 0; n < claimed.size(); ++n) {
+        parent = claimed[n].parent_path();
+        if (parent.empty()) {
+            parent = ".";
+        }
+        if (parent == dir && boost::starts_with(claimed[n].filename().string(),
+            dup_name))
+        {
+            return true;
+        }
+    }
+    if (resume) {
+        return false;
+    }
     bfsys::directory_iterator end_it;
     for (bfsys::directory_iterator itr(dir); itr != end_it; ++itr) {
         if (!bfsys::is_directory(itr->path())) {
@@ -0,0 +1,53 @@
+###############################################################################
+# filename:    allocations.cmake
+# description: Checks that evolutionary steps do not allocate memory
+# author:      agent
+# created:     2026-10-17
+# copyright:   Jacobs University Bremen. All rights reserved.
+###############################################################################
+# Run by ctest as
+#
+#   cmake -DSIMULATION=<path> -DCOUNTER=<path> -DOPTIONS=<options>
+#       -DSHORT=<steps> -DLONG=<steps> -DSLACK=<count> -DWORK_DIR=<path>
+#       -P allocations.cmake
+#
+# Evolves the network 'n' with the options OPTIONS for SHORT and for LONG
+# steps with the library COUNTER preloaded, which counts the heap allocations
+# of a run. Buffers only grow during the first few thousand steps, afterwards
+# a step allocates nothing, thus the longer run may make at most SLACK
+# allocations more than the shorter one. OPTIONS must keep the evolution going for
+# LONG steps.
+###############################################################################
+
+FOREACH(var SIMULATION COUNTER OPTIONS SHORT LONG SLACK WORK_DIR)
+    IF(NOT DEFINED ${var})
+        MESSAGE(FATAL_ERROR "${var} is not defined.")
+    ENDIF(NOT DEFINED ${var})
+ENDFOREACH(var)
+
+SEPARATE_ARGUMENTS(OPTIONS UNIX_COMMAND "${OPTIONS}")
+FILE(REMOVE_RECURSE "${WORK_DIR}")
+FILE(MAKE_DIRECTORY "${WORK_DIR}/short" "${WORK_DIR}/long")
+SET(ENV{LD_PRELOAD} "${COUNTER}")
+
+MACRO(COUNT DIR STEPS)
+    EXECUTE_PROCESS(COMMAND "${SIMULATION}" ${OPTIONS} -e ${STEPS} n
+        WORKING_DIRECTORY "${WORK_DIR}/${DIR}"
+        RESULT_VARIABLE status OUTPUT_QUIET ERROR_VARIABLE errors)
+    IF(NOT status EQUAL 0)
+        MESSAGE(FATAL_ERROR "The ${DIR} run failed (${status}):\n${errors}")
+    ENDIF(NOT status EQUAL 0)
+    IF(NOT errors MATCHES "allocations: ([0-9]+)")
+        MESSAGE(FATAL_ERROR "The ${DIR} run was not counted:\n${errors}")
+    ENDIF(NOT errors MATCHES "allocations: ([0-9]+)")
+    SET(${DIR} ${CMAKE_MATCH_1})
+ENDMACRO(COUNT)
+
+COUNT(short ${SHORT})
+COUNT(long ${LONG})
+MATH(EXPR excess "${long} - ${short}")
+MESSAGE(STATUS "${SHORT} steps: ${short}, ${LONG} steps: ${long} allocations")
+IF(excess GREATER ${SLACK})
+    MESSAGE(FATAL_ERROR "${excess} allocations in the last "
+        "steps of the longer run, at most ${SLACK} were expected.")
+ENDIF(excess GREATER ${SLACK})
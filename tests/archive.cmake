@@ -0,0 +1,54 @@
+###############################################################################
+# filename:    archive.cmake
+# description: Checks that an archive survives a writer killed while appending
+# author:      agent
+# created:     2026-10-17
+# copyright:   Jacobs University Bremen. All rights reserved.
+###############################################################################
+# Run by ctest as
+#
+#   cmake -DSIMULATION=<path> -DCOMPLETE=<options> -DKILLED=<options>
+#       -DTIMEOUT=<seconds> -DWORK_DIR=<path> -P archive.cmake
+#
+# Evolves the network 'n' with the options COMPLETE into an archive that is
+# closed, thus indexed. Then the network 'm' is appended with the options
+# KILLED and killed after TIMEOUT seconds, it should not finish by then. The
+# archive has to open again afterwards and still hold the final state of 'n',
+# which a resumed run of 'n' then skips.
+###############################################################################
+
+FOREACH(var SIMULATION COMPLETE KILLED TIMEOUT WORK_DIR)
+    IF(NOT DEFINED ${var})
+        MESSAGE(FATAL_ERROR "${var} is not defined.")
+    ENDIF(NOT DEFINED ${var})
+ENDFOREACH(var)
+
+SEPARATE_ARGUMENTS(COMPLETE UNIX_COMMAND "${COMPLETE}")
+SEPARATE_ARGUMENTS(KILLED UNIX_COMMAND "${KILLED}")
+FILE(REMOVE_RECURSE "${WORK_DIR}")
+FILE(MAKE_DIRECTORY "${WORK_DIR}")
+
+EXECUTE_PROCESS(COMMAND "${SIMULATION}" ${COMPLETE} --archive runs.rfa n
+    WORKING_DIRECTORY "${WORK_DIR}"
+    RESULT_VARIABLE status OUTPUT_QUIET ERROR_VARIABLE errors)
+IF(NOT status EQUAL 0)
+    MESSAGE(FATAL_ERROR "The complete run failed (${status}):\n${errors}")
+ENDIF(NOT status EQUAL 0)
+
+EXECUTE_PROCESS(COMMAND "${SIMULATION}" ${KILLED} --archive runs.rfa m
+    WORKING_DIRECTORY "${WORK_DIR}" TIMEOUT ${TIMEOUT}
+    RESULT_VARIABLE status OUTPUT_QUIET ERROR_QUIET)
+IF(status EQUAL 0)
+    MESSAGE(FATAL_ERROR "The appending run finished before it was killed.")
+ENDIF(status EQUAL 0)
+
+EXECUTE_PROCESS(COMMAND "${SIMULATION}" ${COMPLETE} --archive runs.rfa
+    --resume n
+    WORKING_DIRECTORY "${WORK_DIR}"
+    RESULT_VARIABLE status OUTPUT_VARIABLE output ERROR_VARIABLE errors)
+IF(NOT status EQUAL 0)
+    MESSAGE(FATAL_ERROR "The archive cannot be opened (${status}):\n${errors}")
+ENDIF(NOT status EQUAL 0)
+IF(NOT output MATCHES "'n' has finished already")
+    MESSAGE(FATAL_ERROR "The final state of 'n' was lost:\n${output}")
+ENDIF(NOT output MATCHES "'n' has finished already")
@@ -0,0 +1,106 @@
+/*******************************************************************************
+ * filename:    malloc_counter.cpp
+ * description: Preloaded library counting the heap allocations of a process
+ * author:      agent
+ * created:     2026-10-17
+ * copyright:   Jacobs University Bremen. All rights reserved.
+ *******************************************************************************
+ * With LD_PRELOAD pointing to this library every call of malloc, calloc and
+ * realloc, including those behind 'new', is counted and passed on to glibc.
+ * The count is written to the standard error as "allocations: <count>" when
+ * the process exits.
+ ******************************************************************************/
+
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+
+// std
+#include <cstddef>
+
+// posix
+#include <unistd.h>
+
+
+/*******************************************************************************
+ * Declarations
+ ******************************************************************************/
+
+
+extern "C" {
+
+    void* __libc_malloc(size_t size);
+    void* __libc_calloc(size_t num, size_t size);
+    void* __libc_realloc(void* ptr, size_t size);
+
+    void* malloc(size_t size);
+    void* calloc(size_t num, size_t size);
+    void* realloc(void* ptr, size_t size);
+
+} // extern "C"
+
+
+namespace {
+
+    unsigned long allocations = 0ul;
+
+    // writes the count without allocating
+    class Report {
+    public:
+        ~Report()
+        {
+            static const char label[] = "allocations: ";
+            char line[sizeof(label) + 24];
+            char digits[24];
+            unsigned long count = __sync_fetch_and_add(&allocations, 0ul);
+            size_t num = 0;
+            do {
+                digits[num++] = (char)('0' + count % 10ul);
+                count /= 10ul;
+            } while (count > 0ul);
+            size_t length = sizeof(label) - 1;
+            for (size_t i = 0; i < length; ++i) {
+                line[i] = label[i];
+            }
+            while (num > 0) {
+                line[length++] = digits[--num];
+            }
+            line[length++] = '\n';
+            if (write(STDERR_FILENO, line, length) < 0) {
+                _exit(1);
+            }
+        }
+    };
+
+    Report report;
+
+} // namespace
+
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+
+void*
+malloc(size_t size)
+{
+    __sync_fetch_and_add(&allocations, 1ul);
+    return __libc_malloc(size);
+}
+
+void*
+calloc(size_t num, size_t size)
+{
+    __sync_fetch_and_add(&allocations, 1ul);
+    return __libc_calloc(num, size);
+}
+
+void*
+realloc(void* ptr, size_t size)
+{
+    __sync_fetch_and_add(&allocations, 1ul);
+    return __libc_realloc(ptr, size);
+}
@@ -0,0 +1,79 @@
+###############################################################################
+# filename:    reproducibility.cmake
+# description: Checks that two ways of running an evolution give equal results
+# author:      agent
+# created:     2026-10-17
+# copyright:   Jacobs University Bremen. All rights reserved.
+###############################################################################
+# Run by ctest as
+#
+#   cmake -DSIMULATION=<path> -DANALYSIS=<path> -DBASELINE=<options>
+#       -DVARIANT=<options> [-DRESUME=<seconds>] -DWORK_DIR=<path>
+#       -P reproducibility.cmake
+#
+# Evolves the network 'n' once with the options BASELINE and once with the
+# options VARIANT, each in a directory of its own below WORK_DIR, and fails
+# unless both write the same result files byte for byte. With RESUME the
+# variant is killed after that many seconds and continued with '--resume',
+# it should then include '--checkpoint'. On a mismatch the summaries of both
+# runs by 'analysis' are printed.
+###############################################################################
+
+FOREACH(var SIMULATION ANALYSIS BASELINE VARIANT WORK_DIR)
+    IF(NOT DEFINED ${var})
+        MESSAGE(FATAL_ERROR "${var} is not defined.")
+    ENDIF(NOT DEFINED ${var})
+ENDFOREACH(var)
+
+SEPARATE_ARGUMENTS(BASELINE UNIX_COMMAND "${BASELINE}")
+SEPARATE_ARGUMENTS(VARIANT UNIX_COMMAND "${VARIANT}")
+FILE(REMOVE_RECURSE "${WORK_DIR}")
+FILE(MAKE_DIRECTORY "${WORK_DIR}/baseline" "${WORK_DIR}/variant")
+
+MACRO(EVOLVE DIR OPTIONS)
+    EXECUTE_PROCESS(COMMAND "${SIMULATION}" ${OPTIONS} n
+        WORKING_DIRECTORY "${WORK_DIR}/${DIR}"
+        RESULT_VARIABLE status OUTPUT_QUIET ERROR_VARIABLE errors)
+    IF(NOT status EQUAL 0)
+        MESSAGE(FATAL_ERROR "The ${DIR} run failed (${status}):\n${errors}")
+    ENDIF(NOT status EQUAL 0)
+ENDMACRO(EVOLVE)
+
+EVOLVE("baseline" "${BASELINE}")
+IF(RESUME)
+    # may finish before it is killed, the resumed run then does nothing
+    EXECUTE_PROCESS(COMMAND "${SIMULATION}" ${VARIANT} n
+        WORKING_DIRECTORY "${WORK_DIR}/variant" TIMEOUT ${RESUME}
+        OUTPUT_QUIET ERROR_QUIET)
+    EVOLVE("variant" "${VARIANT};--resume")
+ELSE(RESUME)
+    EVOLVE("variant" "${VARIANT}")
+ENDIF(RESUME)
+
+FILE(GLOB expected RELATIVE "${WORK_DIR}/baseline" "${WORK_DIR}/baseline/*.dat")
+FILE(GLOB written RELATIVE "${WORK_DIR}/variant" "${WORK_DIR}/variant/*.dat")
+LIST(SORT expected)
+LIST(SORT written)
+SET(mismatches "")
+IF(NOT "${expected}" STREQUAL "${written}")
+    SET(mismatches "the files ${expected} against ${written}")
+ELSE(NOT "${expected}" STREQUAL "${written}")
+    FOREACH(file ${expected})
+        EXECUTE_PROCESS(COMMAND "${CMAKE_COMMAND}" -E compare_files
+            "${WORK_DIR}/baseline/${file}" "${WORK_DIR}/variant/${file}"
+            RESULT_VARIABLE differ)
+        IF(NOT differ EQUAL 0)
+            SET(mismatches "${mismatches} ${file}")
+        ENDIF(NOT differ EQUAL 0)
+    ENDFOREACH(file)
+ENDIF(NOT "${expected}" STREQUAL "${written}")
+
+IF(mismatches)
+    FOREACH(dir baseline variant)
+        EXECUTE_PROCESS(COMMAND "${ANALYSIS}" --suffix .dat .
+            WORKING_DIRECTORY "${WORK_DIR}/${dir}" OUTPUT_VARIABLE summary
+            ERROR_QUIET)
+        MESSAGE("${dir}:\n${summary}")
+    ENDFOREACH(dir)
+    MESSAGE(FATAL_ERROR "Results differ in${mismatches}.")
+ENDIF(mismatches)